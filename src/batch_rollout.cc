@@ -0,0 +1,213 @@
+#include "batch_rollout.h"
+#include <algorithm>
+
+// Bitboards never crosses a translation unit boundary, so the ABI of passing
+// it by value doesn't matter.
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace {
+  // One bitboard per lane. GCC splits the operations into as many vector
+  // instructions as the target supports (two SSE2 registers with arch.h).
+  using Bitboards =
+    std::uint64_t __attribute__((vector_size(sizeof(Bitboard) * rollout_batch_size)));
+
+  inline Bitboards broadcast(const Bitboard b) {
+    Bitboards res;
+    for (int i = 0; i < rollout_batch_size; ++i) res[i] = b;
+    return res;
+  }
+
+  // All ones in lanes where b is zero.
+  inline Bitboards zero_lanes(const Bitboards b) {
+    return reinterpret_cast<Bitboards>(b == 0);
+  }
+
+  template<int dir>
+  inline Bitboards valid_moves_one_dir(const Bitboards player, const Bitboards all) {
+    const Bitboards flippable_l1 = all & (player << dir);
+    const Bitboards flippable_r1 = all & (player >> dir);
+    const Bitboards flippable_l2 = flippable_l1 | (all & (flippable_l1 << dir));
+    const Bitboards flippable_r2 = flippable_r1 | (all & (flippable_r1 >> dir));
+    const Bitboards all_neighbor_r = all & (all << dir);
+    const Bitboards all_neighbor_l = all & (all >> dir);
+    const Bitboards flippable_l4 =
+      flippable_l2 | (all_neighbor_r & (flippable_l2 << (2*dir)));
+    const Bitboards flippable_r4 =
+      flippable_r2 | (all_neighbor_l & (flippable_r2 >> (2*dir)));
+    const Bitboards flippable_l6 =
+      flippable_l4 | (all_neighbor_r & (flippable_l4 << (2*dir)));
+    const Bitboards flippable_r6 =
+      flippable_r4 | (all_neighbor_l & (flippable_r4 >> (2*dir)));
+
+    return (flippable_l6 << dir) | (flippable_r6 >> dir);
+  }
+
+  // Same as Position::valid_moves, per lane.
+  inline Bitboards valid_moves(const Bitboards player, const Bitboards opponent) {
+    const Bitboards all = player | opponent;
+    const Bitboards all_middle = all & ~(left_edge | right_edge);
+
+    const Bitboards moves1 = valid_moves_one_dir<1>(player, all_middle);
+    const Bitboards moves8 = valid_moves_one_dir<8>(player, all);
+    const Bitboards moves7 = valid_moves_one_dir<7>(player, all_middle);
+    const Bitboards moves9 = valid_moves_one_dir<9>(player, all_middle);
+
+    const Bitboards moves = ((moves1 | moves8) | (moves7 | moves9)) & ~all;
+
+    const Bitboards b2 =
+      all |
+      ((all & ~left_edge) >> 1) |
+      ((all & ~right_edge) << 1);
+    const Bitboards adjacent = (b2 | (b2 >> 8) | (b2 << 8)) & ~all;
+
+    return moves | (adjacent & zero_lanes(moves));
+  }
+
+  // Occluded fill: b together with the squares reachable from b by steps of
+  // dir through propagate. Every square of propagate must be enterable by a
+  // step, i.e. masked with mask_shift<dir, edge>.
+  template<int dir>
+  inline Bitboards fill_forward(Bitboards b, Bitboards propagate) {
+    b |= propagate & (b << dir);
+    propagate &= propagate << dir;
+    b |= propagate & (b << (2*dir));
+    propagate &= propagate << (2*dir);
+    b |= propagate & (b << (4*dir));
+    return b;
+  }
+
+  template<int dir>
+  inline Bitboards fill_backward(Bitboards b, Bitboards propagate) {
+    b |= propagate & (b >> dir);
+    propagate &= propagate >> dir;
+    b |= propagate & (b >> (2*dir));
+    propagate &= propagate >> (2*dir);
+    b |= propagate & (b >> (4*dir));
+    return b;
+  }
+
+  // Squares of all that lie strictly between the move and the farthest player
+  // stone, in both senses of direction dir. edge_f and edge_b are the edges
+  // that a step forward (<< dir) and backward (>> dir) can't leave from.
+  template<int dir, Bitboard edge_f, Bitboard edge_b>
+  inline Bitboards flips_one_dir(const Bitboards move,
+                                 const Bitboards player,
+                                 const Bitboards all) {
+    constexpr Bitboard enter_f = ~edge_f << dir;
+    constexpr Bitboard enter_b = ~edge_b >> dir;
+
+    const Bitboards run_f = fill_forward<dir>(move, all & enter_f) & ~move;
+    const Bitboards run_b = fill_backward<dir>(move, all & enter_b) & ~move;
+
+    // Squares of the run that have a player stone farther from the move.
+    const Bitboards flips_f =
+      fill_backward<dir>(((run_f & player) >> dir) & run_f, run_f & enter_b);
+    const Bitboards flips_b =
+      fill_forward<dir>(((run_b & player) << dir) & run_b, run_b & enter_f);
+
+    return (flips_f & run_f) | (flips_b & run_b);
+  }
+
+  inline Bitboards flips(const Bitboards move,
+                         const Bitboards player,
+                         const Bitboards opponent) {
+    const Bitboards all = player | opponent;
+    return
+      (flips_one_dir<1, right_edge, left_edge>(move, player, all) |
+       flips_one_dir<8, bottom_edge, top_edge>(move, player, all)) |
+      (flips_one_dir<7, bottom_edge | left_edge, top_edge | right_edge>(
+          move, player, all) |
+       flips_one_dir<9, bottom_edge | right_edge, top_edge | left_edge>(
+          move, player, all));
+  }
+
+  // xorshift64, one generator per lane.
+  inline Bitboards next_random(Bitboards &state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  }
+}
+
+void batch_random_rollouts(const Position (&positions)[rollout_batch_size],
+                           const bool prefer_corners,
+                           RandomGenerator &rng,
+                           Score (&scores)[rollout_batch_size]) {
+  Bitboards player;
+  Bitboards opponent;
+  Bitboards random_state;
+  int max_empty = 0;
+  for (int i = 0; i < rollout_batch_size; ++i) {
+    player[i] = positions[i].player;
+    opponent[i] = positions[i].opponent;
+    random_state[i] = rng.get_bitboard() | 1u;
+    max_empty = std::max(max_empty, num_squares - positions[i].move_number());
+  }
+
+  const Bitboards corner_mask = broadcast(corners);
+
+  // Finished lanes have no moves, so they don't change. Every active lane
+  // makes one move per step.
+  for (int step = 0; step < max_empty; ++step) {
+    Bitboards moves = valid_moves(player, opponent);
+    if (prefer_corners) {
+      const Bitboards corner_moves = moves & corner_mask;
+      moves = corner_moves | (moves & zero_lanes(corner_moves));
+    }
+    const Bitboards random = next_random(random_state);
+
+    Bitboards move;
+    for (int i = 0; i < rollout_batch_size; ++i) {
+      const Bitboard lane_moves = moves[i];
+      const std::uint64_t n = count_squares(lane_moves);
+      const int index = static_cast<int>(((random[i] >> 32) * n) >> 32);
+      move[i] = lane_moves ? single_square(nth_square(lane_moves, index)) : 0;
+    }
+
+    const Bitboards active = ~zero_lanes(move);
+    const Bitboards flipped = flips(move, player, opponent);
+    const Bitboards next_player = opponent ^ flipped;
+    const Bitboards next_opponent = (player ^ flipped) | move;
+    player = (next_player & active) | (player & ~active);
+    opponent = (next_opponent & active) | (opponent & ~active);
+  }
+
+  for (int i = 0; i < rollout_batch_size; ++i) {
+    // Full board: player is the color that moves at even move numbers.
+    const Score score = static_cast<Score>(count_squares(player[i]) - num_squares / 2);
+    scores[i] = positions[i].to_move() == 0 ? score : -score;
+  }
+}
+
+void batch_valid_moves(const Position (&positions)[rollout_batch_size],
+                       Bitboard (&moves)[rollout_batch_size]) {
+  Bitboards player;
+  Bitboards opponent;
+  for (int i = 0; i < rollout_batch_size; ++i) {
+    player[i] = positions[i].player;
+    opponent[i] = positions[i].opponent;
+  }
+  const Bitboards res = valid_moves(player, opponent);
+  for (int i = 0; i < rollout_batch_size; ++i) moves[i] = res[i];
+}
+
+void batch_make_moves(const Position (&positions)[rollout_batch_size],
+                      const Move (&moves)[rollout_batch_size],
+                      Position (&next_positions)[rollout_batch_size]) {
+  Bitboards player;
+  Bitboards opponent;
+  Bitboards move;
+  for (int i = 0; i < rollout_batch_size; ++i) {
+    player[i] = positions[i].player;
+    opponent[i] = positions[i].opponent;
+    move[i] = single_square(moves[i]);
+  }
+  const Bitboards flipped = flips(move, player, opponent);
+  const Bitboards next_player = opponent ^ flipped;
+  const Bitboards next_opponent = (player ^ flipped) | move;
+  for (int i = 0; i < rollout_batch_size; ++i) {
+    next_positions[i].player = next_player[i];
+    next_positions[i].opponent = next_opponent[i];
+  }
+}
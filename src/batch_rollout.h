@@ -0,0 +1,31 @@
+#ifndef BATCH_ROLLOUT_H
+#define BATCH_ROLLOUT_H
+
+#include "position.h"
+#include "random.h"
+
+constexpr int rollout_batch_size = 4;
+
+// Plays rollout_batch_size random games to the end in lockstep, one game per
+// vector lane. Move generation, flips and the random number generator are
+// vectorized; only picking the n-th valid move is done per lane.
+//
+// scores[i] is the final score for the player to move in positions[i].
+// With prefer_corners, corner moves are always chosen when available.
+void batch_random_rollouts(const Position (&positions)[rollout_batch_size],
+                           bool prefer_corners,
+                           RandomGenerator &rng,
+                           Score (&scores)[rollout_batch_size]);
+
+// The vectorized move generation and flips on their own, for testing.
+// moves[i] = positions[i].valid_moves().
+void batch_valid_moves(const Position (&positions)[rollout_batch_size],
+                       Bitboard (&moves)[rollout_batch_size]);
+
+// positions[i].make_move(moves[i], next_positions[i]). Every move must be
+// valid.
+void batch_make_moves(const Position (&positions)[rollout_batch_size],
+                      const Move (&moves)[rollout_batch_size],
+                      Position (&next_positions)[rollout_batch_size]);
+
+#endif
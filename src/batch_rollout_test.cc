@@ -0,0 +1,84 @@
+#include "batch_rollout.h"
+#include "tests.h"
+#include <set>
+
+namespace {
+  // All final scores for the player to move that random play can reach.
+  void reachable_scores(const Position &position, const int sign,
+                        std::set<Score> &scores) {
+    if (position.finished()) {
+      scores.insert(sign * position.final_score());
+      return;
+    }
+    Bitboard moves = position.valid_moves();
+    while (moves) {
+      const Move move = first_square(moves);
+      moves = remove_first_square(moves);
+      Position next_position;
+      position.make_move(move, next_position);
+      reachable_scores(next_position, sign, scores);
+    }
+  }
+}
+
+TEST(test_batch_moves) {
+  RandomGenerator rng;
+
+  // Lanes play random games, each restarting when its game ends, so every
+  // step mixes different move numbers.
+  Position positions[rollout_batch_size];
+  for (int i = 0; i < rollout_batch_size; ++i) {
+    positions[i] = Position::initial();
+    for (int j = 0; j < i; ++j) {
+      positions[i].make_move(rng.get_square(positions[i].valid_moves()),
+                             positions[i]);
+    }
+  }
+
+  for (int step = 0; step < 20000; ++step) {
+    Bitboard valid_moves[rollout_batch_size];
+    batch_valid_moves(positions, valid_moves);
+    Move moves[rollout_batch_size];
+    for (int i = 0; i < rollout_batch_size; ++i) {
+      assert(valid_moves[i] == positions[i].valid_moves());
+      moves[i] = rng.get_square(valid_moves[i]);
+    }
+
+    Position next_positions[rollout_batch_size];
+    batch_make_moves(positions, moves, next_positions);
+    for (int i = 0; i < rollout_batch_size; ++i) {
+      Position expected;
+      positions[i].make_move(moves[i], expected);
+      assert(next_positions[i] == expected);
+      positions[i] =
+        expected.finished() ? Position::initial() : expected;
+    }
+  }
+}
+
+TEST(test_batch_random_rollouts) {
+  RandomGenerator rng;
+
+  for (int batch = 0; batch < 2000; ++batch) {
+    Position positions[rollout_batch_size];
+    for (int i = 0; i < rollout_batch_size; ++i) {
+      // Lanes finish at different times, including immediately.
+      const int empty = (batch + i) % 4;
+      Position position = Position::initial();
+      while (position.move_number() < num_squares - empty) {
+        position.make_move(rng.get_square(position.valid_moves()), position);
+      }
+      positions[i] = position;
+    }
+
+    Score scores[rollout_batch_size];
+    batch_random_rollouts(positions, batch % 2 == 0, rng, scores);
+
+    for (int i = 0; i < rollout_batch_size; ++i) {
+      std::set<Score> possible;
+      reachable_scores(positions[i], positions[i].to_move() == 0 ? 1 : -1,
+                       possible);
+      assert(possible.count(scores[i]));
+    }
+  }
+}
@@ -1,9 +1,15 @@
+#include "batch_rollout.h"
 #include "bitboard.h"
+#include "book.h"
 #include "clock.h"
+#include "hashing.h"
 #include "logging.h"
+#include "position.h"
 #include "random.h"
+#include <algorithm>
 #include <cassert>
 #include <limits>
+#include <vector>
 
 namespace {
 
@@ -120,6 +126,123 @@ void benchmark_mult_64(const long iterations) {
   assert(res < std::numeric_limits<std::uint64_t>::max());
 }
 
+// rollout_batch_size games per iteration.
+void benchmark_rollouts(const long iterations) {
+  RandomGenerator rng;
+  long res = 0;
+  for (long i = 0; i < iterations; ++i) {
+    for (int j = 0; j < rollout_batch_size; ++j) {
+      Position position = Position::initial();
+      while (!position.finished()) {
+        position.make_move(rng.get_square(position.valid_moves()), position);
+      }
+      res += position.final_score();
+    }
+  }
+  assert(res < std::numeric_limits<long>::max());
+}
+
+void benchmark_batch_rollouts(const long iterations) {
+  RandomGenerator rng;
+  long res = 0;
+  Position positions[rollout_batch_size];
+  for (int j = 0; j < rollout_batch_size; ++j) {
+    positions[j] = Position::initial();
+  }
+  for (long i = 0; i < iterations; ++i) {
+    Score scores[rollout_batch_size];
+    batch_random_rollouts(positions, false, rng, scores);
+    for (int j = 0; j < rollout_batch_size; ++j) {
+      res += scores[j];
+    }
+  }
+  assert(res < std::numeric_limits<long>::max());
+}
+
+#ifndef SUBMISSION
+// Random probes into a table much bigger than the caches and the TLB reach.
+PositionHashTable<int> *probe_table = nullptr;
+std::vector<Position> probe_positions;
+
+void prepare_hash_table_probe() {
+  init_hashing();
+  probe_table = new PositionHashTable<int>(1u << 23);
+  RandomGenerator rng{1};
+  while (probe_positions.size() < probe_table->capacity() / 2) {
+    const Bitboard player = rng.get_bitboard();
+    const Position position{player, rng.get_bitboard() & ~player};
+    bool inserted;
+    probe_table->insert(position, inserted, 1);
+    probe_positions.push_back(position);
+  }
+}
+
+void benchmark_hash_table_probe(const long iterations) {
+  // probe_positions is read sequentially, the table at random.
+  long res = 0;
+  for (long i = 0; i < iterations; ++i) {
+    const Position &position = probe_positions[i % probe_positions.size()];
+    res += *probe_table->find(position);
+  }
+  assert(res == iterations);
+}
+
+// Random early positions, some of them in the book.
+std::vector<Position> book_probe_positions;
+
+void prepare_find_book_move() {
+  init_book();
+  RandomGenerator rng{3};
+  while (book_probe_positions.size() < 1024) {
+    Position position = Position::initial();
+    const int num_moves = rng.get_int(12);
+    for (int i = 0; i < num_moves; ++i) {
+      position.make_move(rng.get_square(position.valid_moves()), position);
+    }
+    book_probe_positions.push_back(position);
+  }
+}
+
+void benchmark_find_book_move(const long iterations) {
+  long res = 0;
+  for (long i = 0; i < iterations; ++i) {
+    res += find_book_move(book_probe_positions[i % book_probe_positions.size()]);
+  }
+  assert(res < std::numeric_limits<long>::max());
+}
+
+// Latency of individual inserts into a table that starts small and grows,
+// compared with one that is big enough from the start.
+void report_hash_table_insert_latency(const bool growable) {
+  constexpr std::size_t num_inserts = 1u << 22;
+  PositionHashTable<int> table(growable ? 1u << 10 : 1u << 23, growable);
+  RandomGenerator rng{2};
+  std::vector<double> latencies;
+  latencies.reserve(num_inserts);
+  for (std::size_t i = 0; i < num_inserts; ++i) {
+    const Bitboard player = rng.get_bitboard();
+    const Position position{player, rng.get_bitboard() & ~player};
+    const Timestamp start_time = current_time();
+    bool inserted;
+    table.insert(position, inserted, 1);
+    latencies.push_back(to_seconds(current_time() - start_time));
+    assert(inserted);
+  }
+  std::sort(latencies.begin(), latencies.end());
+  const auto percentile = [&latencies](const double p) {
+    const std::size_t index = static_cast<std::size_t>(p * (latencies.size() - 1));
+    return latencies[index] * 1e9;
+  };
+  log_always("hash_table_insert %s: "
+             "p50 %.0f ns, p99 %.0f ns, p99.9 %.0f ns, p99.99 %.0f ns, max %.0f ns, "
+             "%.1f bytes/entry\n",
+             growable ? "growable" : "fixed",
+             percentile(0.5), percentile(0.99), percentile(0.999),
+             percentile(0.9999), latencies.back() * 1e9,
+             static_cast<double>(table.memory_bytes()) / table.size());
+}
+#endif
+
 }
 
 int main() {
@@ -134,4 +257,14 @@ int main() {
   BENCHMARK(benchmark_random_square, t);
   BENCHMARK(benchmark_mult_32, t);
   BENCHMARK(benchmark_mult_64, t);
+  BENCHMARK(benchmark_rollouts, t);
+  BENCHMARK(benchmark_batch_rollouts, t);
+#ifndef SUBMISSION
+  prepare_hash_table_probe();
+  BENCHMARK(benchmark_hash_table_probe, t);
+  prepare_find_book_move();
+  BENCHMARK(benchmark_find_book_move, t);
+  report_hash_table_insert_latency(false);
+  report_hash_table_insert_latency(true);
+#endif
 }
@@ -4,6 +4,9 @@
 #include "arch.h"
 #include <cstdint>
 #include <string>
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
 
 using Bitboard = std::uint64_t;
 
@@ -48,12 +51,52 @@ constexpr int parity(const Bitboard b) {
   return __builtin_parityll(b);
 }
 
-constexpr int nth_square(Bitboard b, int index) {
-  while (index) {
-    b = remove_first_square(b);
-    --index;
+// nth_bit_in_byte[index][byte] is the position of the index-th set bit of byte.
+struct NthBitInByteTable {
+  std::uint8_t nth_bit_in_byte[8][256];
+};
+
+constexpr NthBitInByteTable make_nth_bit_in_byte_table() {
+  NthBitInByteTable table{};
+  for (int byte = 0; byte < 256; ++byte) {
+    int index = 0;
+    for (int bit = 0; bit < 8; ++bit) {
+      if (byte & (1 << bit)) {
+        table.nth_bit_in_byte[index][byte] = bit;
+        ++index;
+      }
+    }
   }
-  return first_square(b);
+  return table;
+}
+
+inline constexpr NthBitInByteTable nth_bit_in_byte_table =
+  make_nth_bit_in_byte_table();
+
+// Square of the index-th set bit of b. Requires index < count_squares(b).
+constexpr int nth_square(const Bitboard b, const int index) {
+#ifdef __BMI2__
+  return first_square(_pdep_u64(single_square(index), b));
+#else
+  constexpr Bitboard ones = 0x0101010101010101u;
+  constexpr Bitboard high_bits = 0x8080808080808080u;
+
+  // Counts per byte, then counts of bytes 0..i in byte i.
+  Bitboard counts = b - ((b >> 1) & 0x5555555555555555u);
+  counts = (counts & 0x3333333333333333u) + ((counts >> 2) & 0x3333333333333333u);
+  counts = (counts + (counts >> 4)) & 0x0f0f0f0f0f0f0f0fu;
+  const Bitboard prefix = counts * ones;
+
+  // Bytes with prefix <= index come before the one we want. Prefixes are at
+  // most 64, so the high bit of each byte is free for the comparison.
+  const Bitboard above = ((prefix | high_bits) - (index + 1) * ones) & high_bits;
+  const int byte_index = 8 - count_squares(above);
+  const int shift = 8 * byte_index;
+
+  const int index_in_byte = index - static_cast<int>(((prefix << 8) >> shift) & 0xff);
+  const int byte = static_cast<int>((b >> shift) & 0xff);
+  return shift + nth_bit_in_byte_table.nth_bit_in_byte[index_in_byte][byte];
+#endif
 }
 
 Bitboard bitboard_from_string(const std::string &str);
@@ -1,4 +1,5 @@
 #include "bitboard.h"
+#include "random.h"
 #include "tests.h"
 
 TEST(test_first_last_count_squares) {
@@ -51,6 +52,16 @@ TEST(test_nth_square) {
   for(int i=0;i<64;++i) {
     assert(nth_square(0xffffffffffffffffu, i) == i);
   }
+
+  RandomGenerator rng;
+  for (int iter = 0; iter < 10000; ++iter) {
+    Bitboard b = rng.get_bitboard() & rng.get_bitboard();
+    const Bitboard original = b;
+    for (int i = 0; b; ++i) {
+      assert(nth_square(original, i) == first_square(b));
+      b = remove_first_square(b);
+    }
+  }
 }
 
 TEST(test_bitboard_from_string) {
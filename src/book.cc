@@ -1,23 +1,243 @@
 #include "book.h"
+#include "logging.h"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstring>
+#include <fstream>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+  // Open addressing with linear probing, at most half full. The empty
+  // position marks an empty bucket; it is never in the book.
+  struct BookTable {
+    const Position *positions = nullptr;
+    const Move *moves = nullptr;
+    int bits = 0;
+  };
+
+  constexpr int compiled_book_bits = 17;
+  constexpr std::size_t compiled_book_size = std::size_t{1} << compiled_book_bits;
+
+  Position compiled_book_positions[compiled_book_size];
+  Move compiled_book_moves[compiled_book_size];
+
+  BookTable compiled_book;
+  BookTable book;
+
+  // Book file layout, native byte order:
+  //   BookFileHeader, padded to book_file_data_offset
+  //   Position positions[1 << table_bits]
+  //   Move moves[1 << table_bits]
+  constexpr char book_file_magic[8] = {'F','L','B','K','0','0','0','1'};
+  constexpr std::size_t book_file_data_offset = 64;
+
+  struct BookFileHeader {
+    char magic[8];
+    std::uint32_t table_bits;
+    std::uint32_t reserved;
+    std::uint64_t num_entries;
+  };
+
+  static_assert(sizeof(BookFileHeader) <= book_file_data_offset, "");
+  static_assert(sizeof(Position) == 16, "");
+
+  std::size_t book_file_size(const int table_bits) {
+    return book_file_data_offset +
+           ((sizeof(Position) + sizeof(Move)) << table_bits);
+  }
+
+  void *mapped_book_file = nullptr;
+  std::size_t mapped_book_file_size = 0;
+
+  std::size_t book_bucket(const Position &position, const int bits) {
+    const std::uint64_t h =
+      position.player * 0x9e3779b97f4a7c15u ^
+      (position.opponent * 0xc2b2ae3d27d4eb4fu >> 17);
+    return h >> (64 - bits);
+  }
+
+  void book_table_insert(Position *const positions,
+                         Move *const moves,
+                         const int bits,
+                         const Position &position,
+                         const Move move) {
+    assert(position != Position{});
+    const std::size_t mask = (std::size_t{1} << bits) - 1u;
+    std::size_t bucket = book_bucket(position, bits);
+    while (positions[bucket] != Position{}) {
+      assert(positions[bucket] != position);
+      bucket = (bucket + 1) & mask;
+    }
+    positions[bucket] = position;
+    moves[bucket] = move;
+  }
+
+  // Parses squares up to and including '/'.
+  Bitboard decode_bitboard(const char *&s) {
+    Bitboard b = 0;
+    for (; *s != '/'; ++s) {
+      b = set_bit(b, decode_square(*s));
+    }
+    ++s;
+    return b;
+  }
+}
+
+void init_book() {
+  assert(2 * num_book_entries <= compiled_book_size);
+  for (const auto &entry : compiled_book_entries()) {
+    book_table_insert(compiled_book_positions, compiled_book_moves,
+                      compiled_book_bits, entry.first, entry.second);
+  }
+  compiled_book.positions = compiled_book_positions;
+  compiled_book.moves = compiled_book_moves;
+  compiled_book.bits = compiled_book_bits;
+  if (!mapped_book_file) book = compiled_book;
+}
 
 Move find_book_move(const Position &position) {
+  assert(book.positions);
   Position normalized_position;
   const int symmetry = position.normalize(normalized_position);
 
-  const std::string key = encode_position(normalized_position);
-  const auto it =
-    std::lower_bound(book_entries, book_entries + num_book_entries, key);
-  if (it == book_entries + num_book_entries) {
-    return invalid_move;
+  // A book file may be corrupt: it may have no empty bucket, or moves that
+  // aren't valid.
+  const std::size_t size = std::size_t{1} << book.bits;
+  std::size_t bucket = book_bucket(normalized_position, book.bits);
+  for (std::size_t step = 0; step < size; ++step) {
+    const Position &entry = book.positions[bucket];
+    if (entry == normalized_position) {
+      const Move stored_move = book.moves[bucket];
+      if (stored_move < 0 || stored_move >= num_squares) return invalid_move;
+      const Move move = static_cast<Move>(untransform_square(stored_move, symmetry));
+      return get_bit(position.valid_moves(), move) ? move : invalid_move;
+    }
+    if (entry == Position{}) return invalid_move;
+    bucket = (bucket + 1) & (size - 1u);
+  }
+  return invalid_move;
+}
+
+std::vector<std::pair<Position, Move>> compiled_book_entries() {
+  std::vector<std::pair<Position, Move>> entries;
+  entries.reserve(num_book_entries);
+  for (std::size_t i = 0; i < num_book_entries; ++i) {
+    const char *s = book_entries[i];
+    const Bitboard player = decode_bitboard(s);
+    const Bitboard opponent = decode_bitboard(s);
+    assert(s[0] && !s[1]);
+    entries.emplace_back(Position{player, opponent},
+                         static_cast<Move>(decode_square(s[0])));
+  }
+  return entries;
+}
+
+bool save_book_file(const std::string &file_name,
+                    const std::vector<std::pair<Position, Move>> &entries) {
+  int bits = 4;
+  while ((std::size_t{1} << bits) < 2 * entries.size()) ++bits;
+  const std::size_t size = std::size_t{1} << bits;
+
+  std::vector<Position> positions(size);
+  std::vector<Move> moves(size, invalid_move);
+  for (const auto &entry : entries) {
+    book_table_insert(positions.data(), moves.data(), bits,
+                      entry.first, entry.second);
   }
 
-  const std::string s = *it;
-  if (s.size() != key.size() + 1u || s.substr(0, key.size()) != key) {
-    return invalid_move;
+  BookFileHeader header{};
+  std::copy(book_file_magic, book_file_magic + sizeof(book_file_magic),
+            header.magic);
+  header.table_bits = static_cast<std::uint32_t>(bits);
+  header.num_entries = entries.size();
+  char header_bytes[book_file_data_offset] = {};
+  std::memcpy(header_bytes, &header, sizeof(header));
+
+  std::ofstream f(file_name, std::ios::binary);
+  f.write(header_bytes, sizeof(header_bytes));
+  f.write(reinterpret_cast<const char*>(positions.data()),
+          size * sizeof(Position));
+  f.write(reinterpret_cast<const char*>(moves.data()), size * sizeof(Move));
+  f.close();
+  if (!f) {
+    log_always("%s: write failed\n", file_name.c_str());
+    return false;
   }
-  return untransform_square(decode_square(s[key.size()]), symmetry);
+  return true;
+}
+
+bool load_book_file(const std::string &file_name) {
+#ifdef __linux__
+  const int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    log_always("%s: can't open\n", file_name.c_str());
+    return false;
+  }
+  struct stat file_stat;
+  BookFileHeader header;
+  const bool header_ok =
+    fstat(fd, &file_stat) == 0 &&
+    pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+    std::equal(book_file_magic, book_file_magic + sizeof(book_file_magic),
+               header.magic);
+  if (!header_ok) {
+    close(fd);
+    log_always("%s: not a book file\n", file_name.c_str());
+    return false;
+  }
+  const std::size_t size = static_cast<std::size_t>(file_stat.st_size);
+  if (header.table_bits < 4 || header.table_bits > 40 ||
+      size != book_file_size(header.table_bits)) {
+    close(fd);
+    log_always("%s: wrong size\n", file_name.c_str());
+    return false;
+  }
+  if (header.num_entries >= std::uint64_t{1} << header.table_bits) {
+    close(fd);
+    log_always("%s: table full\n", file_name.c_str());
+    return false;
+  }
+  // Shared, read only: processes using the same file share the page cache.
+  // Pages are read in as lookups touch them.
+  void *const p = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED) {
+    log_always("%s: mmap failed\n", file_name.c_str());
+    return false;
+  }
+
+  close_book_file();
+  mapped_book_file = p;
+  mapped_book_file_size = size;
+  const char *const data = static_cast<const char*>(p) + book_file_data_offset;
+  book.positions = reinterpret_cast<const Position*>(data);
+  book.moves = reinterpret_cast<const Move*>(
+      data + (sizeof(Position) << header.table_bits));
+  book.bits = static_cast<int>(header.table_bits);
+  log_info("Book %s: %llu entries\n", file_name.c_str(),
+           static_cast<unsigned long long>(header.num_entries));
+  return true;
+#else
+  log_always("%s: book files not supported\n", file_name.c_str());
+  return false;
+#endif
+}
+
+void close_book_file() {
+  if (!mapped_book_file) return;
+#ifdef __linux__
+  munmap(mapped_book_file, mapped_book_file_size);
+#endif
+  mapped_book_file = nullptr;
+  mapped_book_file_size = 0;
+  book = compiled_book;
 }
 
 char encode_square(int sq) {
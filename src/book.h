@@ -4,13 +4,34 @@
 #include "position.h"
 #include "evaluator.h"
 #include <string>
+#include <utility>
+#include <vector>
 
+// Source format, generated by book_builder: sorted strings of
+// encode_position(normalized position) followed by encode_square(move).
 extern const size_t num_book_entries;
 extern const char *const book_entries[];
 
-// invalid_move if not found
+// Builds the lookup table from book_entries and uses it unless a book file
+// is loaded.
+void init_book();
+
+// invalid_move if not found.
+// Doesn't allocate; usually one cache miss for the position, one for the move.
 Move find_book_move(const Position &);
 
+// Positions must be normalized.
+std::vector<std::pair<Position, Move>> compiled_book_entries();
+
+// Book files hold the hash table that find_book_move probes, so loading one
+// is a single mmap. Loading replaces the book in use.
+bool save_book_file(const std::string &file_name,
+                    const std::vector<std::pair<Position, Move>> &entries);
+bool load_book_file(const std::string &file_name);
+
+// Back to the compiled-in book.
+void close_book_file();
+
 char encode_square(int sq);
 int decode_square(char c);
 
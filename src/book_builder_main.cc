@@ -1,67 +1,68 @@
 #include "book.h"
+#include "book_graph.h"
 #include "clock.h"
 #include "evaluator.h"
-#include "hashing.h"
 #include "logging.h"
 #include "player_ab.h"
 #include <algorithm>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
 namespace {
 
-struct BookNode;
-
-struct BookEdge {
-  BookNode *destination;
-  Move move;
-};
-
-struct BookNode {
-  Position position;
-  bool expanded;
-  bool initialized;
-  bool visited = false;
-  Milliscore value;
-  Move best_move;
-  Milliscore expand_badness_player;
-  Milliscore expand_badness_opponent;
-  std::vector<BookEdge> children;
-  std::vector<BookEdge> parents;
-};
-
 class BookBuilder {
 public:
   BookBuilder(int argc, char **argv);
   void go();
 private:
-  BookNode *find_or_create_node(const Position &position);
-  void initialize(BookNode *);
+  void initialize(PlayerAB &player, BookNode *);
+  void worker_thread();
+  void queue_initialize(BookNode *);
   BookNode *find_node_to_expand();
-  void expand(BookNode *);
-  void expand_thread(BookNode *);
+  void start_expansions();
+  void start_expansion(BookNode *);
+  void finish_expansions();
   void update(BookNode *);
-  void update_node(BookNode *);
   void print_book();
   void collect_entries(BookNode *node,
                        bool player,
-                       std::vector<std::string> &entries,
+                       std::vector<std::pair<Position, Move>> &entries,
                        std::vector<BookNode*> &all_visited);
+  bool save_checkpoint();
+  bool load_checkpoint(const std::string &file_name);
 
   Duration think_time{};
   Duration total_time{};
   int num_threads=1;
-  static constexpr Milliscore depth_badness = 200000;
+  std::string checkpoint_file;
+  Duration checkpoint_interval = std::chrono::minutes(10);
+  // Added to the badness of a node while it's being expanded, so that other
+  // expansions go elsewhere.
+  static constexpr Milliscore virtual_loss_badness =
+    10 * BookGraph::depth_badness;
 
+  BookGraph graph;
   BookNode *root;
-  PositionHashTable<BookNode*> lookup_table{1<<20};
+
+  // Only the main thread builds the graph. Workers initialize nodes, each
+  // with its own PlayerAB.
+  std::vector<BookNode*> expansions_in_flight;
   std::mutex expand_lock;
-  size_t num_nodes = 0;
-  int max_move_number = 0;
+  std::condition_variable job_available;
+  std::condition_variable job_done;
+  std::deque<BookNode*> jobs;
+  bool stop_workers = false;
+  size_t num_initialized = 0;
+
+  // Nodes recomputed by update.
+  size_t num_updates = 0;
+  size_t total_update_touched = 0;
+  size_t max_update_touched = 0;
 };
 
 BookBuilder::BookBuilder(int argc, char **argv) {
@@ -74,9 +75,24 @@ BookBuilder::BookBuilder(int argc, char **argv) {
     } else if (arg == "-total") {
       assert(next < argc);
       total_time = std::chrono::seconds{std::stol(argv[next++])};
+    } else if (arg == "-export_book") {
+      // Write the compiled-in book as a book file.
+      assert(next < argc);
+      std::exit(save_book_file(argv[next++], compiled_book_entries()) ?
+                EXIT_SUCCESS : EXIT_FAILURE);
     } else if (arg == "-threads") {
       assert(next < argc);
       num_threads = std::stoi(argv[next++]);
+    } else if (arg == "-checkpoint") {
+      // Saved every checkpoint_interval and at the end.
+      assert(next < argc);
+      checkpoint_file = argv[next++];
+    } else if (arg == "-checkpoint_interval") {
+      assert(next < argc);
+      checkpoint_interval = std::chrono::seconds{std::stol(argv[next++])};
+    } else if (arg == "-resume") {
+      assert(next < argc);
+      if (!load_checkpoint(argv[next++])) std::exit(1);
     } else {
       log_always("Invalid argument: %s\n", arg.c_str());
       std::exit(1);
@@ -88,41 +104,53 @@ BookBuilder::BookBuilder(int argc, char **argv) {
 }
 
 void BookBuilder::go() {
-  Timestamp deadline = current_time() + total_time;
-  root = find_or_create_node(Position::initial());
-  initialize(root);
-  while (current_time() < deadline) {
-    BookNode *const node = find_node_to_expand();
-    expand(node);
-    update(node);
+  const Timestamp start_time = current_time();
+  const Timestamp deadline = start_time + total_time;
+
+  std::vector<std::thread> workers;
+  for (int i=0;i<num_threads;++i) {
+    workers.emplace_back(&BookBuilder::worker_thread, this);
+  }
+
+  root = graph.find_or_create_node(Position::initial());
+  if (!root->initialized) {
+    queue_initialize(root);
+    std::unique_lock<std::mutex> lock(expand_lock);
+    job_done.wait(lock, [this]{ return root->initialized; });
+  }
+
+  Timestamp next_checkpoint = start_time + checkpoint_interval;
+  for (;;) {
+    if (current_time() < deadline) start_expansions();
+    if (expansions_in_flight.empty()) break;
+    finish_expansions();
+    if (!checkpoint_file.empty() && current_time() >= next_checkpoint) {
+      save_checkpoint();
+      next_checkpoint = current_time() + checkpoint_interval;
+    }
   }
-  print_book();
-}
 
-BookNode *BookBuilder::find_or_create_node(const Position &position) {
-  Position normalized_position;
-  position.normalize(normalized_position);
   {
-    BookNode **p = lookup_table.find(normalized_position);
-    if (p) return *p;
+    std::lock_guard<std::mutex> lg(expand_lock);
+    stop_workers = true;
+  }
+  job_available.notify_all();
+  for (auto &th : workers) {
+    th.join();
   }
-  BookNode *node = new BookNode;
-  node->position = normalized_position;
-  node->expanded = false;
-  node->expand_badness_player = 0;
-  node->expand_badness_opponent = 0;
-  node->initialized = false;
-  ++num_nodes;
-  max_move_number = std::max(max_move_number, node->position.move_number());
-  bool inserted;
-  lookup_table.insert(normalized_position, inserted, node);
-  assert(inserted);
 
-  return node;
+  const double hours = to_seconds(current_time() - start_time) / 3600.0;
+  log_always("initialized=%zu per_hour=%.0f\n",
+             num_initialized, num_initialized / hours);
+  log_always("updates=%zu touched_per_update=%.2f max_touched=%zu\n",
+             num_updates,
+             static_cast<double>(total_update_touched) / std::max<size_t>(num_updates, 1),
+             max_update_touched);
+  if (!checkpoint_file.empty()) save_checkpoint();
+  print_book();
 }
 
-void BookBuilder::initialize(BookNode *const node) {
-  PlayerAB player;
+void BookBuilder::initialize(PlayerAB &player, BookNode *const node) {
   PlaySettings settings;
   settings.start_time = current_time();
   settings.time_left = think_time;
@@ -132,7 +160,34 @@ void BookBuilder::initialize(BookNode *const node) {
   assert(!node->position.finished());
   node->best_move = player.choose_move(node->position, settings);
   node->value = player.get_last_move_milliscore();
-  node->initialized = true;
+}
+
+void BookBuilder::worker_thread() {
+  // Reused, so the transposition table is allocated once per worker.
+  PlayerAB player;
+  std::unique_lock<std::mutex> lock(expand_lock);
+  for (;;) {
+    job_available.wait(lock, [this]{ return stop_workers || !jobs.empty(); });
+    if (stop_workers) return;
+    BookNode *const node = jobs.front();
+    jobs.pop_front();
+    lock.unlock();
+    initialize(player, node);
+    lock.lock();
+    node->initialized = true;
+    ++num_initialized;
+    job_done.notify_one();
+  }
+}
+
+void BookBuilder::queue_initialize(BookNode *const node) {
+  {
+    std::lock_guard<std::mutex> lg(expand_lock);
+    if (node->queued) return;
+    node->queued = true;
+    jobs.push_back(node);
+  }
+  job_available.notify_one();
 }
 
 BookNode *BookBuilder::find_node_to_expand() {
@@ -169,111 +224,112 @@ BookNode *BookBuilder::find_node_to_expand() {
   return node;
 }
 
-void BookBuilder::expand(BookNode *const node) {
-  assert(!node->expanded);
-  Bitboard remaining_moves = node->position.valid_moves();
-  while (remaining_moves) {
-    const Move move = first_square(remaining_moves);
-    remaining_moves = reset_bit(remaining_moves, move);
-    Position next_position;
-    node->position.make_move(move, next_position);
-    BookNode *child = find_or_create_node(next_position);
-    node->children.push_back({child, move});
-    child->parents.push_back({node, move});
-  }
-
-  std::vector<std::thread> threads;
-  for (int i=0;i<num_threads;++i) {
-    threads.emplace_back(&BookBuilder::expand_thread, this, node);
-  }
-
-  for (auto &th : threads) {
-    th.join();
-  }
-
-  node->expanded = true;
-}
-
-void BookBuilder::expand_thread(BookNode *const node) {
-  for (const auto &edge : node->children) {
-    BookNode *child = edge.destination;
-    bool initialized;
+void BookBuilder::start_expansions() {
+  for (;;) {
     {
       std::lock_guard<std::mutex> lg(expand_lock);
-      initialized = child->initialized;
-      if (!initialized) child->initialized = true;
-    }
-    if (!initialized) {
-      initialize(child);
+      if (jobs.size() >= static_cast<size_t>(num_threads)) return;
     }
+    BookNode *const node = find_node_to_expand();
+    // Even with the virtual loss the best line leads to a node in flight.
+    if (node->expanding) return;
+    start_expansion(node);
   }
 }
 
-void BookBuilder::update(BookNode *const start) {
-  std::vector<BookNode*> all_visited;
-  std::queue<BookNode*> q;
-  q.push(start);
-  start->visited = true;
-  all_visited.push_back(start);
-  while (!q.empty()) {
-    BookNode *const node = q.front(); q.pop();
-    update_node(node);
-    for (const BookEdge &edge : node->parents) {
-      BookNode *parent = edge.destination;
-      if (!parent->visited) {
-        q.push(parent);
-        parent->visited = true;
-        all_visited.push_back(parent);
-      }
-    }
+void BookBuilder::start_expansion(BookNode *const node) {
+  assert(!node->expanded && !node->expanding);
+  graph.add_children(node);
+  for (const BookEdge &edge : node->children) {
+    queue_initialize(edge.destination);
   }
 
-  for (BookNode *node : all_visited) {
-    node->visited = false;
-  }
+  node->expanding = true;
+  node->expand_badness_player += virtual_loss_badness;
+  node->expand_badness_opponent += virtual_loss_badness;
+  update(node);
+  expansions_in_flight.push_back(node);
 }
 
-void BookBuilder::update_node(BookNode *const node) {
-  node->best_move = invalid_move;
-  node->value = -max_milliscore;
-  BookNode *best_child = nullptr;
+// Waits until at least one expansion in flight has all its children
+// initialized.
+void BookBuilder::finish_expansions() {
+  std::vector<BookNode*> finished;
+  {
+    std::unique_lock<std::mutex> lock(expand_lock);
+    const auto all_initialized = [](const BookNode *const node) {
+      for (const BookEdge &edge : node->children) {
+        if (!edge.destination->initialized) return false;
+      }
+      return true;
+    };
+    job_done.wait(lock, [&]{
+      return std::any_of(expansions_in_flight.begin(),
+                         expansions_in_flight.end(),
+                         all_initialized);
+    });
+    const auto it = std::stable_partition(expansions_in_flight.begin(),
+                                          expansions_in_flight.end(),
+                                          [&](const BookNode *const node) {
+                                            return !all_initialized(node);
+                                          });
+    finished.assign(it, expansions_in_flight.end());
+    expansions_in_flight.erase(it, expansions_in_flight.end());
+  }
 
-  for (const BookEdge &edge : node->children) {
-    const Milliscore value = -edge.destination->value;
-    if (value > node->value) {
-      node->best_move = edge.move;
-      node->value = value;
-      best_child = edge.destination;
-    }
+  for (BookNode *const node : finished) {
+    node->expanding = false;
+    node->expanded = true;
+    update(node);
   }
-  assert(best_child && node->best_move != invalid_move);
+}
 
-  node->expand_badness_player =
-    best_child->expand_badness_opponent + depth_badness;
+void BookBuilder::update(BookNode *const start) {
+  const size_t touched = graph.update(start);
+  ++num_updates;
+  total_update_touched += touched;
+  max_update_touched = std::max(max_update_touched, touched);
+}
 
-  node->expand_badness_opponent = max_milliscore;
-  for (const BookEdge &edge : node->children) {
-    node->expand_badness_opponent =
-      std::min(node->expand_badness_opponent,
-               edge.destination->expand_badness_player +
-               edge.destination->value - best_child->value +
-               depth_badness);
+bool BookBuilder::save_checkpoint() {
+  std::lock_guard<std::mutex> lg(expand_lock);
+  if (!graph.save_checkpoint(checkpoint_file)) return false;
+  log_always("checkpoint nodes=%zu\n", graph.nodes().size());
+  return true;
+}
+
+bool BookBuilder::load_checkpoint(const std::string &file_name) {
+  if (!graph.load_checkpoint(file_name)) return false;
+  size_t num_expanded = 0;
+  for (BookNode *const node : graph.nodes()) {
+    node->queued = true;
+    num_expanded += node->expanded;
   }
-  assert(node->expand_badness_opponent < max_milliscore);
+  log_always("resumed nodes=%zu expanded=%zu\n",
+             graph.nodes().size(), num_expanded);
+  return true;
 }
 
 void BookBuilder::print_book() {
   log_always("num_nodes=%zu max_move_number=%d root_value=%.6f\n",
-             num_nodes,
-             max_move_number,
+             graph.nodes().size(),
+             graph.max_move_number(),
              std::ldexp(root->value, -milliscore_bits));
 
-  std::vector<std::string> book_entries;
+  std::vector<std::pair<Position, Move>> entries;
   std::vector<BookNode*> all_visited;
   for (bool player : {true, false}) {
-    collect_entries(root, player, book_entries, all_visited);
+    collect_entries(root, player, entries, all_visited);
     for (BookNode *p : all_visited) p->visited = false;
   }
+
+  save_book_file("book.tmp", entries);
+
+  std::vector<std::string> book_entries;
+  for (const auto &entry : entries) {
+    book_entries.push_back(encode_position(entry.first) +
+                           encode_square(entry.second));
+  }
   std::sort(book_entries.begin(), book_entries.end());
 
   std::ofstream f("book_data.tmp");
@@ -289,14 +345,13 @@ void BookBuilder::print_book() {
 
 void BookBuilder::collect_entries(BookNode *node,
                                   bool player,
-                                  std::vector<std::string> &entries,
+                                  std::vector<std::pair<Position, Move>> &entries,
                                   std::vector<BookNode*> &all_visited) {
   if (node->visited) return;
   node->visited = true;
   all_visited.push_back(node);
   if (player) {
-    entries.push_back(encode_position(node->position) +
-                      encode_square(node->best_move));
+    entries.emplace_back(node->position, node->best_move);
   }
   if (node->expanded) {
     for (const BookEdge &edge : node->children) {
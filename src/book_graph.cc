@@ -0,0 +1,226 @@
+#include "book_graph.h"
+#include "logging.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <queue>
+
+namespace {
+  constexpr char checkpoint_magic[8] = {'F','L','B','B','0','0','0','1'};
+
+  struct BookNodeRecord {
+    Bitboard player;
+    Bitboard opponent;
+    Milliscore value;
+    Move best_move;
+    std::uint8_t expanded;
+    std::uint8_t padding[2];
+  };
+
+  static_assert(sizeof(BookNodeRecord) == 24, "");
+}
+
+BookGraph::~BookGraph() {
+  for (BookNode *const node : all_nodes) delete node;
+}
+
+BookNode *BookGraph::find_or_create_node(const Position &position) {
+  Position normalized_position;
+  position.normalize(normalized_position);
+  {
+    BookNode **p = lookup_table.find(normalized_position);
+    if (p) return *p;
+  }
+  BookNode *node = new BookNode;
+  node->position = normalized_position;
+  all_nodes.push_back(node);
+  m_max_move_number = std::max(m_max_move_number, node->position.move_number());
+  bool inserted;
+  lookup_table.insert(normalized_position, inserted, node);
+  assert(inserted);
+
+  return node;
+}
+
+void BookGraph::add_children(BookNode *const node) {
+  assert(node->children.empty());
+  Bitboard remaining_moves = node->position.valid_moves();
+  while (remaining_moves) {
+    const Move move = first_square(remaining_moves);
+    remaining_moves = reset_bit(remaining_moves, move);
+    Position next_position;
+    node->position.make_move(move, next_position);
+    BookNode *child = find_or_create_node(next_position);
+    node->children.push_back({child, move});
+    child->parents.push_back({node, move});
+  }
+}
+
+void BookGraph::update_node(BookNode *const node) {
+  node->best_move = invalid_move;
+  node->value = -max_milliscore;
+  BookNode *best_child = nullptr;
+
+  for (const BookEdge &edge : node->children) {
+    const Milliscore value = -edge.destination->value;
+    if (value > node->value) {
+      node->best_move = edge.move;
+      node->value = value;
+      best_child = edge.destination;
+    }
+  }
+  assert(best_child && node->best_move != invalid_move);
+
+  node->expand_badness_player =
+    best_child->expand_badness_opponent + depth_badness;
+
+  node->expand_badness_opponent = max_milliscore;
+  for (const BookEdge &edge : node->children) {
+    node->expand_badness_opponent =
+      std::min(node->expand_badness_opponent,
+               edge.destination->expand_badness_player +
+               edge.destination->value - best_child->value +
+               depth_badness);
+  }
+  assert(node->expand_badness_opponent < max_milliscore);
+}
+
+std::size_t BookGraph::update(BookNode *const start) {
+  const auto shallower = [](const BookNode *const a, const BookNode *const b) {
+    return a->position.move_number() < b->position.move_number();
+  };
+  std::priority_queue<BookNode*, std::vector<BookNode*>, decltype(shallower)>
+    q{shallower};
+  std::vector<BookNode*> all_visited;
+  q.push(start);
+  start->visited = true;
+  all_visited.push_back(start);
+  std::size_t touched = 0;
+  while (!q.empty()) {
+    BookNode *const node = q.top(); q.pop();
+    // A node in flight only passes its virtual loss on to its parents.
+    if (node != start) {
+      const Milliscore old_value = node->value;
+      const Move old_best_move = node->best_move;
+      const Milliscore old_badness_player = node->expand_badness_player;
+      const Milliscore old_badness_opponent = node->expand_badness_opponent;
+      update_node(node);
+      ++touched;
+      if (node->value == old_value &&
+          node->best_move == old_best_move &&
+          node->expand_badness_player == old_badness_player &&
+          node->expand_badness_opponent == old_badness_opponent) {
+        continue;
+      }
+    } else if (node->expanded) {
+      update_node(node);
+      ++touched;
+    }
+    for (const BookEdge &edge : node->parents) {
+      BookNode *parent = edge.destination;
+      if (!parent->visited) {
+        q.push(parent);
+        parent->visited = true;
+        all_visited.push_back(parent);
+      }
+    }
+  }
+
+  for (BookNode *node : all_visited) {
+    node->visited = false;
+  }
+  return touched;
+}
+
+bool BookGraph::save_checkpoint(const std::string &file_name) const {
+  std::vector<BookNodeRecord> records;
+  for (const BookNode *const node : all_nodes) {
+    if (!node->initialized) continue;
+    BookNodeRecord record{};
+    record.player = node->position.player;
+    record.opponent = node->position.opponent;
+    record.value = node->value;
+    record.best_move = node->best_move;
+    record.expanded = node->expanded;
+    records.push_back(record);
+  }
+
+  const std::string tmp_file = file_name + ".new";
+  {
+    std::ofstream f(tmp_file, std::ios::binary);
+    const std::uint64_t num_records = records.size();
+    f.write(checkpoint_magic, sizeof(checkpoint_magic));
+    f.write(reinterpret_cast<const char*>(&num_records), sizeof(num_records));
+    f.write(reinterpret_cast<const char*>(records.data()),
+            records.size() * sizeof(BookNodeRecord));
+    f.close();
+    if (!f) {
+      log_always("%s: write failed\n", tmp_file.c_str());
+      return false;
+    }
+  }
+  if (std::rename(tmp_file.c_str(), file_name.c_str()) != 0) {
+    log_always("%s: rename failed\n", file_name.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool BookGraph::load_checkpoint(const std::string &file_name) {
+  assert(all_nodes.empty());
+  std::ifstream f(file_name, std::ios::binary);
+  char magic[sizeof(checkpoint_magic)];
+  f.read(magic, sizeof(magic));
+  if (!f || !std::equal(magic, magic + sizeof(magic), checkpoint_magic)) {
+    log_always("%s: not a book checkpoint\n", file_name.c_str());
+    return false;
+  }
+  std::uint64_t num_records = 0;
+  f.read(reinterpret_cast<char*>(&num_records), sizeof(num_records));
+  // Read in chunks, so a corrupt count doesn't allocate more than the file.
+  std::vector<BookNodeRecord> records;
+  while (f && records.size() < num_records) {
+    const std::size_t chunk =
+      std::min<std::uint64_t>(num_records - records.size(), 1<<16);
+    const std::size_t old_size = records.size();
+    records.resize(old_size + chunk);
+    f.read(reinterpret_cast<char*>(records.data() + old_size),
+           chunk * sizeof(BookNodeRecord));
+  }
+  if (!f) {
+    log_always("%s: truncated\n", file_name.c_str());
+    return false;
+  }
+
+  std::vector<BookNode*> expanded;
+  for (const BookNodeRecord &record : records) {
+    BookNode *const node =
+      find_or_create_node(Position{record.player, record.opponent});
+    node->value = record.value;
+    node->best_move = record.best_move;
+    node->initialized = true;
+    if (record.expanded) expanded.push_back(node);
+  }
+  for (BookNode *const node : expanded) {
+    add_children(node);
+    for (const BookEdge &edge : node->children) {
+      if (!edge.destination->initialized) {
+        log_always("%s: child of an expanded node missing\n",
+                   file_name.c_str());
+        return false;
+      }
+    }
+    node->expanded = true;
+  }
+
+  // Children are one move later than their parents.
+  std::sort(expanded.begin(), expanded.end(),
+            [](const BookNode *const a, const BookNode *const b) {
+              return a->position.move_number() > b->position.move_number();
+            });
+  for (BookNode *const node : expanded) {
+    update_node(node);
+  }
+  return true;
+}
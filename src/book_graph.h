@@ -0,0 +1,80 @@
+#ifndef BOOK_GRAPH_H
+#define BOOK_GRAPH_H
+
+#include "evaluator.h"
+#include "hashing.h"
+#include "position.h"
+#include <string>
+#include <vector>
+
+// The graph that book_builder grows: normalized positions reachable from the
+// initial position, with minimax values and how bad it would be for each
+// side to expand them next.
+
+struct BookNode;
+
+struct BookEdge {
+  BookNode *destination;
+  Move move;
+};
+
+struct BookNode {
+  Position position;
+  bool expanded = false;
+  // Children are being initialized.
+  bool expanding = false;
+  // Waiting for or being initialized by a worker.
+  bool queued = false;
+  // Has value and best_move. Guarded by book_builder's expand_lock until the
+  // node is expanded.
+  bool initialized = false;
+  bool visited = false;
+  Milliscore value = 0;
+  Move best_move = invalid_move;
+  Milliscore expand_badness_player = 0;
+  Milliscore expand_badness_opponent = 0;
+  std::vector<BookEdge> children;
+  std::vector<BookEdge> parents;
+};
+
+class BookGraph {
+public:
+  BookGraph() = default;
+  BookGraph(const BookGraph &) = delete;
+  BookGraph &operator=(const BookGraph &) = delete;
+  ~BookGraph();
+
+  static constexpr Milliscore depth_badness = 200000;
+
+  BookNode *find_or_create_node(const Position &position);
+  // The children of node that are not in the graph yet are created.
+  void add_children(BookNode *node);
+
+  // Recomputes an expanded node from its children.
+  static void update_node(BookNode *node);
+  // start has changed. Parents are recomputed only when a child changed,
+  // deepest first, so each node is recomputed once, after all its changed
+  // children. Returns the number of nodes recomputed.
+  std::size_t update(BookNode *start);
+
+  const std::vector<BookNode*> &nodes() const { return all_nodes; }
+  int max_move_number() const { return m_max_move_number; }
+
+  // Checkpoint file: the magic "FLBB0001", the node count, then one record
+  // per initialized node. Edges and badness are not stored: the children of
+  // an expanded node are its positions after each valid move, and badness
+  // follows from the values.
+  //
+  // Nodes being expanded are saved as leaves. Written to a new file which is
+  // then renamed, so a crash leaves the previous checkpoint.
+  bool save_checkpoint(const std::string &file_name) const;
+  // Into an empty graph. Fails if an expanded node misses a child.
+  bool load_checkpoint(const std::string &file_name);
+
+private:
+  PositionHashTable<BookNode*> lookup_table{1<<16, true};
+  std::vector<BookNode*> all_nodes;
+  int m_max_move_number = 0;
+};
+
+#endif
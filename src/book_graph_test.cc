@@ -0,0 +1,135 @@
+#include "book_graph.h"
+#include "random.h"
+#include "tests.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+namespace {
+  // Small values, so that there are ties.
+  Milliscore random_value(RandomGenerator &rng) {
+    return (rng.get_int(21) - 10) << milliscore_bits;
+  }
+
+  // Expands random leaves, like book_builder but without searching.
+  void build_random_graph(BookGraph &graph, RandomGenerator &rng,
+                          const int num_expansions) {
+    BookNode *const root = graph.find_or_create_node(Position::initial());
+    root->value = random_value(rng);
+    root->initialized = true;
+    for (int i = 0; i < num_expansions; ++i) {
+      std::vector<BookNode*> leaves;
+      for (BookNode *const node : graph.nodes()) {
+        if (!node->expanded) leaves.push_back(node);
+      }
+      BookNode *const node =
+        leaves[rng.get_int(static_cast<int>(leaves.size()))];
+      graph.add_children(node);
+      for (const BookEdge &edge : node->children) {
+        BookNode *const child = edge.destination;
+        if (child->initialized) continue;
+        child->value = random_value(rng);
+        child->best_move = first_square(child->position.valid_moves());
+        child->initialized = true;
+      }
+      node->expanded = true;
+      graph.update(node);
+    }
+  }
+}
+
+TEST(test_book_checkpoint) {
+  const std::string file_name = "book_checkpoint_test.tmp";
+  RandomGenerator rng;
+  BookGraph graph;
+  build_random_graph(graph, rng, 30);
+  assert(graph.save_checkpoint(file_name));
+
+  BookGraph loaded;
+  assert(loaded.load_checkpoint(file_name));
+  assert(loaded.nodes().size() == graph.nodes().size());
+  for (const BookNode *const node : graph.nodes()) {
+    const BookNode *const copy = loaded.find_or_create_node(node->position);
+    assert(copy->initialized);
+    assert(copy->expanded == node->expanded);
+    assert(copy->value == node->value);
+    assert(copy->best_move == node->best_move);
+    assert(copy->expand_badness_player == node->expand_badness_player);
+    assert(copy->expand_badness_opponent == node->expand_badness_opponent);
+    assert(copy->children.size() == node->children.size());
+    for (std::size_t i = 0; i < node->children.size(); ++i) {
+      assert(copy->children[i].move == node->children[i].move);
+      assert(copy->children[i].destination->position ==
+             node->children[i].destination->position);
+    }
+  }
+  assert(loaded.nodes().size() == graph.nodes().size());
+
+  // Bad magic.
+  {
+    std::fstream f(file_name, std::ios::binary | std::ios::in | std::ios::out);
+    f.write("XXXX", 4);
+  }
+  {
+    BookGraph bad;
+    assert(!bad.load_checkpoint(file_name));
+  }
+
+  // Truncated.
+  assert(graph.save_checkpoint(file_name));
+  std::string contents;
+  {
+    std::ifstream f(file_name, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(f),
+                    std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream f(file_name, std::ios::binary);
+    f.write(contents.data(), contents.size() - 1);
+  }
+  {
+    BookGraph bad;
+    assert(!bad.load_checkpoint(file_name));
+  }
+  std::remove(file_name.c_str());
+}
+
+TEST(test_book_graph_update) {
+  RandomGenerator rng;
+  for (int iteration = 0; iteration < 20; ++iteration) {
+    BookGraph graph;
+    build_random_graph(graph, rng, 40);
+
+    std::vector<BookNode*> leaves;
+    std::vector<BookNode*> expanded;
+    for (BookNode *const node : graph.nodes()) {
+      (node->expanded ? expanded : leaves).push_back(node);
+    }
+    // Children are one move later than their parents.
+    std::sort(expanded.begin(), expanded.end(),
+              [](const BookNode *const a, const BookNode *const b) {
+                return a->position.move_number() > b->position.move_number();
+              });
+
+    for (int change = 0; change < 10; ++change) {
+      BookNode *const leaf =
+        leaves[rng.get_int(static_cast<int>(leaves.size()))];
+      leaf->value = random_value(rng);
+      graph.update(leaf);
+
+      std::vector<BookNode> incremental;
+      for (const BookNode *const node : expanded) incremental.push_back(*node);
+      for (BookNode *const node : expanded) BookGraph::update_node(node);
+      for (std::size_t i = 0; i < expanded.size(); ++i) {
+        const BookNode &node = *expanded[i];
+        assert(incremental[i].value == node.value);
+        assert(incremental[i].best_move == node.best_move);
+        assert(incremental[i].expand_badness_player ==
+               node.expand_badness_player);
+        assert(incremental[i].expand_badness_opponent ==
+               node.expand_badness_opponent);
+      }
+    }
+  }
+}
@@ -1,8 +1,116 @@
 #include "book.h"
 #include "tests.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 
 TEST(test_encode_square) {
   for (int i=0;i<64;++i) {
     assert(decode_square(encode_square(i)) == i);
   }
 }
+
+TEST(test_find_book_move) {
+  // The first entry, in every symmetry.
+  const std::string entry = book_entries[0];
+  const std::size_t player_end = entry.find('/');
+  const std::size_t opponent_end = entry.find('/', player_end + 1);
+  Bitboard player = 0;
+  for (std::size_t i = 0; i < player_end; ++i) {
+    player = set_bit(player, decode_square(entry[i]));
+  }
+  Bitboard opponent = 0;
+  for (std::size_t i = player_end + 1; i < opponent_end; ++i) {
+    opponent = set_bit(opponent, decode_square(entry[i]));
+  }
+  const Position position{player, opponent};
+  const int move = decode_square(entry[opponent_end + 1]);
+
+  for (int symmetry = 0; symmetry < 8; ++symmetry) {
+    const Move book_move = find_book_move(position.transform(symmetry));
+    assert(book_move == transform_square(move, symmetry));
+  }
+
+  assert(find_book_move(Position::initial()) != invalid_move);
+  const Position far_from_book(
+    "XXXXXXXX"
+    "XXXXXXXX"
+    "XXXXXXXX"
+    "XXXXXXXX"
+    "OOOOOOOO"
+    "OOOOOOOO"
+    "OOOOOOO."
+    "OOOOOOO.");
+  assert(find_book_move(far_from_book) == invalid_move);
+}
+
+TEST(test_book_file) {
+  const std::string file_name = "book_test.tmp";
+  const std::vector<std::pair<Position, Move>> entries = compiled_book_entries();
+  assert(entries.size() == num_book_entries);
+  assert(save_book_file(file_name, {entries[0], entries[1]}));
+  assert(load_book_file(file_name));
+  std::remove(file_name.c_str());
+
+  assert(find_book_move(entries[0].first) == entries[0].second);
+  assert(find_book_move(entries[1].first) == entries[1].second);
+  assert(find_book_move(entries[2].first) == invalid_move);
+
+  close_book_file();
+  assert(find_book_move(entries[2].first) == entries[2].second);
+  assert(!load_book_file(file_name));
+}
+
+namespace {
+  // Writes a book file with the given header and table, bypassing the
+  // checks of save_book_file.
+  void write_raw_book_file(const std::string &file_name,
+                           const std::uint32_t table_bits,
+                           const std::uint64_t num_entries,
+                           const std::vector<Position> &positions,
+                           const std::vector<Move> &moves) {
+    char header[64] = {'F','L','B','K','0','0','0','1'};
+    std::memcpy(header + 8, &table_bits, sizeof(table_bits));
+    std::memcpy(header + 16, &num_entries, sizeof(num_entries));
+    std::ofstream f(file_name, std::ios::binary);
+    f.write(header, sizeof(header));
+    f.write(reinterpret_cast<const char*>(positions.data()),
+            positions.size() * sizeof(Position));
+    f.write(reinterpret_cast<const char*>(moves.data()), moves.size() * sizeof(Move));
+  }
+}
+
+TEST(test_corrupt_book_file) {
+  const std::string file_name = "book_test.tmp";
+  constexpr std::uint32_t bits = 4;
+  constexpr std::size_t size = std::size_t{1} << bits;
+
+  // Every bucket full: lookups of other positions must still end.
+  std::vector<Position> positions(size);
+  std::vector<Move> moves(size);
+  Position position = Position::initial();
+  for (std::size_t i = 0; i < size; ++i) {
+    position.normalize(positions[i]);
+    position.make_move(first_square(position.valid_moves()), position);
+  }
+  // Out of range, occupied square, valid move.
+  const Move valid_move = first_square(positions[2].valid_moves());
+  moves[0] = 100;
+  moves[1] = first_square(positions[1].player);
+  moves[2] = valid_move;
+
+  write_raw_book_file(file_name, bits, size, positions, moves);
+  assert(!load_book_file(file_name));
+
+  write_raw_book_file(file_name, bits, size - 1u, positions, moves);
+  assert(load_book_file(file_name));
+  std::remove(file_name.c_str());
+
+  assert(find_book_move(positions[0]) == invalid_move);
+  assert(find_book_move(positions[1]) == invalid_move);
+  assert(find_book_move(positions[2]) == valid_move);
+  // position is one move past the last table entry.
+  assert(find_book_move(position) == invalid_move);
+
+  close_book_file();
+}
@@ -17,14 +17,12 @@ int main() {
     f << "{\n";
     for (int deep=0;deep<=max_probcut_depth;++deep) {
       const int shallow = probcut_depth[deep];
-      double offset = 0;
-      double stddev = 0;
+      ProbCutInfo info{shallow, 1.0, 0.0, 0.0};
       if (shallow != -1) {
-        const ProbCutInfo &info = prob_cut_info_long[move_number][deep][shallow];
-        offset = info.offset;
-        stddev = info.stddev;
+        info = prob_cut_info_long[move_number][deep][shallow];
       }
-      f << "  {" << shallow << "," << offset << "," << stddev << "},\n";
+      f << "  {" << info.shallow_depth << "," << info.slope << ","
+        << info.intercept << "," << info.stddev << "},\n";
     }
     f << "},\n";
   }
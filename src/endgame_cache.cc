@@ -0,0 +1,52 @@
+#include "endgame_cache.h"
+#include "logging.h"
+#include <algorithm>
+#include <cassert>
+
+EndgameCache::EndgameCache(const std::size_t entries) :
+    m_mask{entries - 1u},
+    m_entries{new Entry[entries]} {
+  assert(entries > 0 && (entries & (entries - 1u)) == 0);
+  log_info("EndgameCache allocated %.2f MB\n",
+           static_cast<double>(size_bytes()) / (1<<20));
+}
+
+bool EndgameCache::find(const Position &position,
+                        Score &lower, Score &upper) const {
+  const std::uint64_t k = key(position);
+  const Entry &entry = m_entries[k & m_mask];
+  const std::uint64_t data = entry.data.load(std::memory_order_relaxed);
+  const std::uint64_t check = entry.check.load(std::memory_order_relaxed);
+  if ((check ^ data) != k || !(data & valid_bit)) return false;
+  lower = static_cast<Score>(static_cast<std::uint8_t>(data));
+  upper = static_cast<Score>(static_cast<std::uint8_t>(data >> 8));
+  return true;
+}
+
+void EndgameCache::store(const Position &position,
+                         const Score score,
+                         const Score alpha,
+                         const Score beta) {
+  Score lower = score > alpha ? score : -max_score;
+  Score upper = score < beta ? score : max_score;
+
+  // Keep what we already know about the same position.
+  Score old_lower, old_upper;
+  if (find(position, old_lower, old_upper)) {
+    lower = std::max(lower, old_lower);
+    upper = std::min(upper, old_upper);
+  }
+
+  const std::uint64_t k = key(position);
+  Entry &entry = m_entries[k & m_mask];
+  const std::uint64_t data = pack(lower, upper);
+  entry.data.store(data, std::memory_order_relaxed);
+  entry.check.store(k ^ data, std::memory_order_relaxed);
+}
+
+void EndgameCache::clear() {
+  for (std::size_t i = 0; i <= m_mask; ++i) {
+    m_entries[i].data.store(0, std::memory_order_relaxed);
+    m_entries[i].check.store(0, std::memory_order_relaxed);
+  }
+}
@@ -0,0 +1,56 @@
+#ifndef ENDGAME_CACHE_H
+#define ENDGAME_CACHE_H
+
+#include "arch.h"
+#include "position.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Lossy cache of exact endgame scores and bounds, keyed by a 64-bit hash of
+// the position. Thread-safe without locks: each entry stores key ^ data next
+// to data, so a torn entry doesn't match any key.
+class EndgameCache {
+public:
+  // entries must be a power of 2.
+  explicit EndgameCache(std::size_t entries);
+
+  std::size_t size_bytes() const { return (m_mask + 1u) * sizeof(Entry); }
+
+  // Returns false if position is not in the cache.
+  bool find(const Position &position, Score &lower, Score &upper) const;
+
+  // Result of a fail-soft search with window (alpha, beta).
+  void store(const Position &position, Score score, Score alpha, Score beta);
+
+  void clear();
+
+private:
+  struct Entry {
+    std::atomic<std::uint64_t> check{0};
+    std::atomic<std::uint64_t> data{0};
+  };
+
+  static constexpr std::uint64_t valid_bit = std::uint64_t{1} << 16;
+
+  static std::uint64_t key(const Position &position) {
+    std::uint64_t h =
+      position.player * 0x9e3779b97f4a7c15u ^
+      position.opponent * 0xc2b2ae3d27d4eb4fu;
+    h ^= h >> 32;
+    h *= 0xbf58476d1ce4e5b9u;
+    h ^= h >> 29;
+    return h;
+  }
+
+  static std::uint64_t pack(const Score lower, const Score upper) {
+    return valid_bit |
+           (std::uint64_t{static_cast<std::uint8_t>(upper)} << 8) |
+           std::uint64_t{static_cast<std::uint8_t>(lower)};
+  }
+
+  std::size_t m_mask;
+  std::unique_ptr<Entry[]> m_entries;
+};
+
+#endif
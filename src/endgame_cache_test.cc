@@ -0,0 +1,31 @@
+#include "endgame_cache.h"
+#include "tests.h"
+
+TEST(test_endgame_cache) {
+  EndgameCache cache(1<<4);
+  const Position position = Position::initial();
+  Score lower, upper;
+  assert(!cache.find(position, lower, upper));
+
+  // Fail high: lower bound.
+  cache.store(position, 5, -2, 3);
+  assert(cache.find(position, lower, upper));
+  assert(lower == 5 && upper == max_score);
+
+  // Fail low: upper bound, merged with the lower bound.
+  cache.store(position, 7, 8, 10);
+  assert(cache.find(position, lower, upper));
+  assert(lower == 5 && upper == 7);
+
+  // Exact.
+  cache.store(position, 6, -10, 10);
+  assert(cache.find(position, lower, upper));
+  assert(lower == 6 && upper == 6);
+
+  Position next_position;
+  position.make_move(first_square(position.valid_moves()), next_position);
+  assert(!cache.find(next_position, lower, upper));
+
+  cache.clear();
+  assert(!cache.find(position, lower, upper));
+}
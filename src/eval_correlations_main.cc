@@ -1,67 +1,308 @@
+#include "book.h"
 #include "clock.h"
+#include "game_record.h"
 #include "hashing.h"
 #include "logging.h"
+#include "parallel.h"
 #include "player_ab.h"
+#include "prepared.h"
 #include "prob_cut.h"
 #include "referee_util.h"
 #include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <fstream>
+#include <memory>
 
 namespace {
+  // Sums for the least squares fit of deep = slope * shallow + intercept.
+  // Exact integers, so that the result doesn't depend on how the games were
+  // split between threads. Scores are in milliscores; their squares
+  // overflow 64 bits after a few thousand samples.
   struct ProbCutStats {
-    double num_samples;
-    double total_offset;
-    double total_offset_squared;
+    std::int64_t num_samples;
+    std::int64_t total_shallow;
+    std::int64_t total_deep;
+    __int128 total_shallow_squared;
+    __int128 total_deep_squared;
+    __int128 total_shallow_deep;
+
+    void add(const std::int64_t shallow, const std::int64_t deep) {
+      num_samples += 1;
+      total_shallow += shallow;
+      total_deep += deep;
+      total_shallow_squared += __int128{shallow} * shallow;
+      total_deep_squared += __int128{deep} * deep;
+      total_shallow_deep += __int128{shallow} * deep;
+    }
+
+    ProbCutStats &operator+=(const ProbCutStats &other) {
+      num_samples += other.num_samples;
+      total_shallow += other.total_shallow;
+      total_deep += other.total_deep;
+      total_shallow_squared += other.total_shallow_squared;
+      total_deep_squared += other.total_deep_squared;
+      total_shallow_deep += other.total_shallow_deep;
+      return *this;
+    }
+
+    ProbCutStats &operator-=(const ProbCutStats &other) {
+      num_samples -= other.num_samples;
+      total_shallow -= other.total_shallow;
+      total_deep -= other.total_deep;
+      total_shallow_squared -= other.total_shallow_squared;
+      total_deep_squared -= other.total_deep_squared;
+      total_shallow_deep -= other.total_shallow_deep;
+      return *this;
+    }
+
+    // Of deep - (slope * shallow + intercept).
+    double sum_squared_errors(const double slope, const double intercept) const {
+      const double n = num_samples;
+      const double s = total_shallow;
+      const double d = total_deep;
+      const double ss = static_cast<double>(total_shallow_squared);
+      const double dd = static_cast<double>(total_deep_squared);
+      const double sd = static_cast<double>(total_shallow_deep);
+      return dd - 2.0 * slope * sd - 2.0 * intercept * d +
+        slope * slope * ss + 2.0 * slope * intercept * s +
+        n * intercept * intercept;
+    }
   };
 
-  ProbCutStats prob_cut_stats[num_squares][max_probcut_depth+1][max_probcut_depth];
+  // Games are split into folds for cross-validation.
+  constexpr int num_folds = 5;
+
+  using ProbCutTable =
+    ProbCutStats[num_folds][num_squares][max_probcut_depth+1][max_probcut_depth];
+
+  // Models are fitted to the samples of a bucket of move numbers: a single
+  // move number has too few. Move numbers of the same parity, since
+  // evaluations alternate with the side to move.
+  constexpr int bucket_move_numbers = 2;
+
+  int first_move_number_in_bucket(const int move_number) {
+    return move_number - move_number % (2 * bucket_move_numbers) + move_number % 2;
+  }
+
+  // With slope 1 the model is the old constant offset between depths. A
+  // fitted slope far from 1 means too few samples or no correlation.
+  constexpr double min_slope = 0.5;
+  constexpr double max_slope = 2.0;
+
+  ProbCutInfo fit_offset(const int shallow, const ProbCutStats &stats) {
+    ProbCutInfo info{shallow, 1.0, 0.0, 0.0};
+    if (stats.num_samples == 0) return info;
+    info.intercept =
+      static_cast<double>(stats.total_deep - stats.total_shallow) / stats.num_samples;
+    info.stddev = std::sqrt(std::max(
+        stats.sum_squared_errors(info.slope, info.intercept) / stats.num_samples,
+        0.0));
+    return info;
+  }
+
+  ProbCutInfo fit_linear(const int shallow, const ProbCutStats &stats) {
+    if (stats.num_samples < 2) return fit_offset(shallow, stats);
+    const double n = stats.num_samples;
+    const double mean_shallow = stats.total_shallow / n;
+    const double mean_deep = stats.total_deep / n;
+    const double variance_shallow =
+      static_cast<double>(stats.total_shallow_squared) / n - mean_shallow * mean_shallow;
+    const double covariance =
+      static_cast<double>(stats.total_shallow_deep) / n - mean_shallow * mean_deep;
+    if (!(variance_shallow > 0.0)) return fit_offset(shallow, stats);
+    const double slope = covariance / variance_shallow;
+    if (slope < min_slope || slope > max_slope) return fit_offset(shallow, stats);
+
+    ProbCutInfo info{shallow, slope, mean_deep - slope * mean_shallow, 0.0};
+    info.stddev = std::sqrt(std::max(
+        stats.sum_squared_errors(info.slope, info.intercept) / n, 0.0));
+    return info;
+  }
+
+  // 100 ms searches fit, and reset() before every position stays cheap.
+  constexpr std::size_t transposition_table_buckets = 1<<18;
+
+  struct ThreadState {
+    ThreadState() :
+      player{PlayerAB::EvaluatorType::pattern, transposition_table_buckets} {}
+
+    PlayerAB player;
+    ProbCutTable prob_cut_stats = {};
+  };
+
+  ProbCutTable prob_cut_stats = {};
+
+  void add_samples(ThreadState &state, const int fold, const Position &pos) {
+    // Evaluations at lower depths must not see deeper results of the
+    // previous position.
+    state.player.reset();
+
+    Milliscore evals[max_probcut_depth+1] = {};
+    for (int depth = 0; depth <= max_probcut_depth; ++depth) {
+      evals[depth] = state.player.evaluate_depth(pos, depth);
+    }
+
+    for (int deep = 0; deep <= max_probcut_depth; ++deep) {
+      for (int shallow = 0; shallow < deep; ++shallow) {
+        state.prob_cut_stats[fold][pos.move_number()][deep][shallow].add(
+            evals[shallow], evals[deep]);
+      }
+    }
+  }
+
+  // Samples of all folds in the bucket of move_number.
+  ProbCutStats bucket_stats(const int fold, const int move_number,
+                            const int deep, const int shallow) {
+    ProbCutStats stats{};
+    const int first = first_move_number_in_bucket(move_number);
+    for (int i = 0; i < bucket_move_numbers; ++i) {
+      stats += prob_cut_stats[fold][first + 2 * i][deep][shallow];
+    }
+    return stats;
+  }
+
+  ProbCutStats bucket_stats(const int move_number, const int deep, const int shallow) {
+    ProbCutStats stats{};
+    for (int fold = 0; fold < num_folds; ++fold) {
+      stats += bucket_stats(fold, move_number, deep, shallow);
+    }
+    return stats;
+  }
+
+  // Root mean square error of the deep score predicted by the offset and
+  // linear models, each fitted without the fold it is tested on. The margin
+  // of a cut is proportional to it.
+  void report_cross_validation(const int initial_stones) {
+    printf("Cross-validated RMS error of deep score, discs: offset linear\n");
+    for (int deep = min_probcut_depth; deep <= max_probcut_depth; ++deep) {
+      for (int shallow = 0; shallow < deep; ++shallow) {
+        double errors_offset = 0.0;
+        double errors_linear = 0.0;
+        double n = 0.0;
+        for (int bucket = initial_stones; bucket < num_squares; ++bucket) {
+          if (first_move_number_in_bucket(bucket) != bucket) continue;
+          const ProbCutStats all = bucket_stats(bucket, deep, shallow);
+          for (int fold = 0; fold < num_folds; ++fold) {
+            const ProbCutStats test = bucket_stats(fold, bucket, deep, shallow);
+            ProbCutStats train = all;
+            train -= test;
+            const ProbCutInfo offset = fit_offset(shallow, train);
+            const ProbCutInfo linear = fit_linear(shallow, train);
+            errors_offset += test.sum_squared_errors(offset.slope, offset.intercept);
+            errors_linear += test.sum_squared_errors(linear.slope, linear.intercept);
+            n += test.num_samples;
+          }
+        }
+        if (n == 0.0) continue;
+        printf("deep=%d shallow=%d%s: %.4f %.4f\n",
+               deep, shallow,
+               probcut_depth[deep] == shallow ? " (used)" : "",
+               std::ldexp(std::sqrt(errors_offset / n), -milliscore_bits),
+               std::ldexp(std::sqrt(errors_linear / n), -milliscore_bits));
+      }
+    }
+  }
 }
 
-int main() {
+// -games <file>: use the positions of recorded games instead of playing.
+// -record <file>: record the games played.
+// -threads <n>: games in parallel.
+int main(int argc, char **argv) {
   verbosity = 0;
   init_hashing();
   init_evaluator();
+  init_book();
+  init_prepared();
 
   constexpr int initial_stones = 8;
   constexpr Duration time_per_move = std::chrono::milliseconds(100);
 
-  const std::vector<Position> starting_positions =
-    generate_starting_positions(initial_stones);
+  GameRecordReader games_in;
+  GameRecordWriter games_out;
+  bool use_records = false;
+  int num_threads = 1;
+  for (int next = 1; next < argc; next += 2) {
+    const std::string arg{argv[next]};
+    assert(next + 1 < argc);
+    if (arg == "-games") {
+      if (!games_in.open(argv[next+1])) return 1;
+      use_records = true;
+    } else if (arg == "-record") {
+      if (!games_out.open(argv[next+1])) return 1;
+    } else if (arg == "-threads") {
+      num_threads = std::stoi(argv[next+1]);
+    } else {
+      log_always("Invalid argument: %s\n", arg.c_str());
+      return 1;
+    }
+  }
+  assert(num_threads >= 1);
 
-  for (size_t i=0; i<starting_positions.size(); ++i) {
-    log_always("Game %zu/%zu\n", i, starting_positions.size());
-    Position pos = starting_positions[i];
+  // Recorded games, or games to play from the starting positions.
+  std::vector<GameRecord> games;
+  if (use_records) {
+    GameRecord record;
+    while (games_in.read(record)) games.push_back(record);
+  } else {
+    for (const Position &position : generate_starting_positions(initial_stones)) {
+      games.emplace_back();
+      games.back().start = position;
+    }
+  }
 
-    for(;;) {
-      if(pos.finished()) break;
+  std::vector<std::unique_ptr<ThreadState>> thread_states;
+  for (int i = 0; i < num_threads; ++i) {
+    thread_states.push_back(std::make_unique<ThreadState>());
+  }
 
-      PlayerAB player;
+  parallel_for(num_threads, static_cast<long>(games.size()),
+    [&](const int thread, const long i) {
+      ThreadState &state = *thread_states[thread];
+      GameRecord &game = games[i];
+      const int fold = static_cast<int>(i % num_folds);
+      Position pos = game.start;
+      if (use_records) {
+        for (int move_index = 0; move_index < game.num_moves; ++move_index) {
+          add_samples(state, fold, pos);
+          pos.make_move(game.moves[move_index].move, pos);
+        }
+        return;
+      }
 
-      Milliscore evals[max_probcut_depth+1] = {};
-      for (int depth = 0; depth <= max_probcut_depth; ++depth) {
-        evals[depth] = player.evaluate_depth(pos, depth);
+      while (!pos.finished()) {
+        add_samples(state, fold, pos);
+
+        PlaySettings settings;
+        settings.start_time = current_time();
+        settings.time_left = time_per_move;
+        settings.use_all_resources = true;
+
+        const Move move = state.player.choose_move(pos, settings);
+        game.add_move(move, state.player, current_time() - settings.start_time);
+        pos.make_move(move, pos);
       }
+    },
+    [&](const long i) {
+      log_always("Game %ld/%zu\n", i, games.size());
+      if (!use_records && games_out.is_open()) games_out.write(games[i]);
+    });
 
-      for (int deep = 0; deep <= max_probcut_depth; ++deep) {
-        for (int shallow = 0; shallow < deep; ++shallow) {
-          double offset = evals[shallow] - evals[deep];
-          auto &stats = prob_cut_stats[pos.move_number()][deep][shallow];
-          stats.num_samples += 1.0;
-          stats.total_offset += offset;
-          stats.total_offset_squared += offset * offset;
+  for (const auto &state : thread_states) {
+    for (int fold = 0; fold < num_folds; ++fold) {
+      for (int move_number = 0; move_number < num_squares; ++move_number) {
+        for (int deep = 0; deep <= max_probcut_depth; ++deep) {
+          for (int shallow = 0; shallow < deep; ++shallow) {
+            prob_cut_stats[fold][move_number][deep][shallow] +=
+              state->prob_cut_stats[fold][move_number][deep][shallow];
+          }
         }
       }
-
-      PlaySettings settings;
-      settings.start_time = current_time();
-      settings.time_left = time_per_move;
-      settings.use_all_resources = true;
-
-      const Move move = player.choose_move(pos, settings);
-      pos.make_move(move, pos);
     }
   }
 
+  report_cross_validation(initial_stones);
+
   std::ofstream f("prob_cut_info_long.tmp");
   f << "#include \"prob_cut.h\"\n";
   f << "extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][max_probcut_depth] = {\n";
@@ -72,16 +313,19 @@ int main() {
       f << "  // deep = " << deep << "\n";
       f << "  {\n";
       for (int shallow=0;shallow<deep;++shallow) {
-        const auto &stats = prob_cut_stats[std::max(move_number, initial_stones)][deep][shallow];
+        // Same parity as move_number.
+        const int sampled_move_number =
+          move_number >= initial_stones ? move_number :
+          initial_stones + (move_number + initial_stones) % 2;
+        const ProbCutStats stats = bucket_stats(sampled_move_number, deep, shallow);
         assert(stats.num_samples > 0);
-        const double offset = stats.total_offset / stats.num_samples;
-        const double stddev = std::sqrt(stats.total_offset_squared / stats.num_samples - offset * offset);
-        f << "    {" << shallow << "," << offset << "," << stddev << "},\n";
+        const ProbCutInfo info = fit_linear(shallow, stats);
+        f << "    {" << info.shallow_depth << "," << info.slope << ","
+          << info.intercept << "," << info.stddev << "},\n";
       }
       f << "  },\n";
     }
     f << "},\n";
   }
   f << "};\n";
-
 }
@@ -1,5 +1,6 @@
 #include "evaluator.h"
 #include <algorithm>
+#include <cmath>
 
 extern const Milliscore evaluator_to_move_bonus[num_squares+1] = {
 300000, -300000, 300000, -300000, 300000, -300000, 300000, -300000, 300715, -274012, 
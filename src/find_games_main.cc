@@ -1,4 +1,5 @@
 #include "book.h"
+#include "endgame_cache.h"
 #include "evaluator.h"
 #include "hashing.h"
 #include "logging.h"
@@ -6,21 +7,69 @@
 #include "player_deterministic.h"
 #include "prepared.h"
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstdlib>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace {
 
 struct State {
   Position position;
-  Position middle;
   Milliscore value;
+  // Index in the previous beam and our move from there.
+  std::uint32_t parent;
+  Move move;
 
-  explicit State() : position(), middle(), value(-max_milliscore) {}
+  explicit State() :
+    position(), value(-max_milliscore), parent(0), move(invalid_move) {}
+};
+
+// Row, column and diagonals through each square.
+struct LineMasks {
+  Bitboard masks[num_squares];
+};
+
+constexpr LineMasks make_line_masks() {
+  LineMasks res{};
+  for (int sq = 0; sq < num_squares; ++sq) {
+    const int x = sq % 8;
+    const int y = sq / 8;
+    for (int sq2 = 0; sq2 < num_squares; ++sq2) {
+      const int x2 = sq2 % 8;
+      const int y2 = sq2 / 8;
+      if (x2 == x || y2 == y || x2 - y2 == x - y || x2 + y2 == x + y) {
+        res.masks[sq] |= Bitboard{1} << sq2;
+      }
+    }
+  }
+  return res;
+}
+
+constexpr LineMasks line_masks = make_line_masks();
+
+// Stones that can't be flipped any more: only a move on the same line can
+// flip a stone, and never the last stone of a line.
+Bitboard stable_squares(const Position &position) {
+  Bitboard unstable = 0;
+  Bitboard empty = ~(position.player | position.opponent);
+  while (empty) {
+    unstable |= line_masks.masks[first_square(empty)];
+    empty = remove_first_square(empty);
+  }
+  return ~unstable | corners;
+}
+
+struct BeamLink {
+  std::uint32_t parent;
+  Move move;
 };
 
 inline bool operator==(const State &a, const State &b) {
@@ -43,14 +92,18 @@ public:
   void go();
 private:
   void advance_beam();
-  void reduce_next_beam();
-  State brute_search_beam();
-  void brute_search_beam_rec(const Position &position,
-                             Prepared &game);
-  void recover_moves(const Position &position1,
-                     const Position &position2);
-  State get_state(const Position &position);
-  Milliscore evaluate_rec(const Position &position, int d);
+  void advance_beam_thread(int thread_index, std::vector<State> &local_beam);
+  void reduce_beam(std::vector<State> &states, State &threshold);
+  void merge_local_beams(std::vector<std::vector<State>> &local_beams);
+  size_t brute_search_beam();
+  void brute_search_beam_thread(int thread_index);
+  Score brute_solve(const Position &position, Score alpha, Player &opp);
+  Score brute_move_score(const Position &position, Move move, Score alpha,
+                         Player &opp, Move &opp_move);
+  void brute_recover(const Position &position, Score score);
+  void recover_moves(const Position &start_position, size_t index);
+  State get_state(const Position &position, Player &opp);
+  Milliscore evaluate_rec(const Position &position, int d, Player &opp);
   void print();
 
   size_t beam_size = 0;
@@ -59,14 +112,32 @@ private:
   int depth = 0;
   std::vector<State> beam;
   std::vector<State> next_beam;
+  // For each beam after the first, how its states were reached.
+  std::vector<std::vector<BeamLink>> beam_links;
   int symmetry = -1;
   bool use_prepared = false;
   int good_moves = 0;
+  int num_threads = 1;
+  std::function<std::unique_ptr<Player>()> make_opponent;
   std::unique_ptr<Player> opponent;
+  // One per beam search thread.
+  std::vector<std::unique_ptr<Player>> thread_opponents;
   std::unique_ptr<Player> full_opponent;
   std::string opponent_name;
   Prepared best_game;
+  // A state not better than beam_thresholds[move number] is known not to be
+  // in the beam. Shared by beam search threads.
   State beam_thresholds[num_squares];
+  std::mutex beam_thresholds_lock;
+
+  // Tail search. States of the beam are handed out through
+  // next_brute_index; brute_scores[i] is exact if it beats the best score
+  // known when beam[i] was searched, otherwise an upper bound.
+  EndgameCache brute_cache{1u << 22};
+  static constexpr int brute_cache_max_move_number = 56;
+  std::atomic<size_t> next_brute_index{0};
+  std::atomic<int> best_brute_score{-max_score};
+  std::vector<Score> brute_scores;
 };
 
 FindGames::FindGames(int argc, char **argv) {
@@ -85,6 +156,9 @@ FindGames::FindGames(int argc, char **argv) {
     } else if (arg == "-color") {
       assert(next < argc);
       color = std::stoi(argv[next++]);
+    } else if (arg == "-threads") {
+      assert(next < argc);
+      num_threads = std::stoi(argv[next++]);
     } else if (arg == "-prepared") {
       use_prepared = true;
     } else if (arg == "-good_moves") {
@@ -93,13 +167,13 @@ FindGames::FindGames(int argc, char **argv) {
     } else if (arg == "-first") {
       assert(next < argc);
       symmetry = std::stoi(argv[next++]);
-      opponent = std::make_unique<PlayerFirst>(0);
+      make_opponent = []() { return std::make_unique<PlayerFirst>(0); };
       full_opponent = std::make_unique<PlayerFirst>(symmetry);
       opponent_name = "first" + std::to_string(symmetry);
     } else if (arg == "-greedy") {
       assert(next < argc);
       symmetry = std::stoi(argv[next++]);
-      opponent = std::make_unique<PlayerGreedy>(0);
+      make_opponent = []() { return std::make_unique<PlayerGreedy>(0); };
       full_opponent = std::make_unique<PlayerGreedy>(symmetry);
       opponent_name = "greedy" + std::to_string(symmetry);
     } else {
@@ -107,14 +181,18 @@ FindGames::FindGames(int argc, char **argv) {
       std::exit(1);
     }
   }
-  assert(beam_size > 0);
+  assert(beam_size > 0 && beam_size <= std::numeric_limits<std::uint32_t>::max());
   assert(brute_threshold > 0 && brute_threshold + depth <= num_squares-2);
   assert(brute_threshold % 2 == color);
   assert(depth>=0 && depth%2==0);
   assert(color == 0 || color == 1);
-  assert(opponent != nullptr);
+  assert(make_opponent);
+  assert(num_threads > 0);
+  opponent = make_opponent();
+  for (int i = 0; i < num_threads; ++i) {
+    thread_opponents.push_back(make_opponent());
+  }
   beam.reserve(beam_size);
-  next_beam.reserve(2 * beam_size);
 }
 
 void FindGames::go() {
@@ -130,8 +208,7 @@ void FindGames::go() {
     if (start_position.to_move() == color) {
       move = find_book_move(start_position);
       if (move == invalid_move && use_prepared) {
-        move = find_prepared_game(start_position.move_number(),
-                                  best_game.moves);
+        move = find_prepared_move(start_position);
       }
       if (move == invalid_move && start_position.move_number() < good_moves) {
         PlayerAB player;
@@ -153,27 +230,20 @@ void FindGames::go() {
   start_position = start_position.transform(symmetry);
 
   beam.clear();
-  beam.push_back(get_state(start_position));
+  beam.push_back(get_state(start_position, *opponent));
 
-  const int middle_move_number = start_position.move_number()
-    + 2 * ((brute_threshold-start_position.move_number()) / 4);
+  beam_links.clear();
   while (beam.front().position.move_number() < brute_threshold) {
-    if (beam[0].position.move_number() == middle_move_number) {
-      for (State &state : beam) {
-        state.middle = state.position;
-      }
-    }
     advance_beam();
     log_info("move_number=%d value=%.6f\n",
              beam.front().position.move_number(),
              std::ldexp(beam.front().value, -milliscore_bits));
   }
   const Timestamp t2 = current_time();
-  const State brute_state = brute_search_beam();
+  const size_t brute_index = brute_search_beam();
   const Timestamp t3 = current_time();
   log_info("score=%d\n", static_cast<int>(best_game.score));
-  recover_moves(start_position, brute_state.middle);
-  recover_moves(brute_state.middle, brute_state.position);
+  recover_moves(start_position, brute_index);
   const Timestamp t4 = current_time();
 
   for (int i = start_position.move_number(); i < num_squares; ++i) {
@@ -186,152 +256,277 @@ void FindGames::go() {
   print();
 }
 
+// The beam is split into contiguous parts, one per thread. Each thread keeps
+// the best beam_size states of its part, then they are merged.
 void FindGames::advance_beam() {
+  std::vector<std::vector<State>> local_beams(num_threads);
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(&FindGames::advance_beam_thread, this, i,
+                         std::ref(local_beams[i]));
+  }
+  advance_beam_thread(0, local_beams[0]);
+  for (auto &th : threads) {
+    th.join();
+  }
+  merge_local_beams(local_beams);
+
+  std::vector<BeamLink> links(beam.size());
+  for (size_t i = 0; i < beam.size(); ++i) {
+    links[i] = BeamLink{beam[i].parent, beam[i].move};
+  }
+  beam_links.push_back(std::move(links));
+}
+
+void FindGames::advance_beam_thread(const int thread_index,
+                                    std::vector<State> &local_beam) {
   StateBetter state_better;
-  next_beam.clear();
-  State &threshold = beam_thresholds[beam[0].position.move_number()+2];
-  for (const State &state : beam) {
+  Player &opp = *thread_opponents[thread_index];
+  const int next_move_number = beam[0].position.move_number() + 2;
+  State threshold;
+  {
+    std::lock_guard<std::mutex> lg(beam_thresholds_lock);
+    threshold = beam_thresholds[next_move_number];
+  }
+  // Exact for the local top beam_size as long as it's bigger than that.
+  // Reducing at twice the size keeps the selection work linear in the
+  // number of pushes.
+  const size_t local_limit = 2 * beam_size;
+
+  // Positions reached by more than one path are kept once.
+  PositionHashTable<bool> seen{1u << 10, true};
+
+  const size_t begin = beam.size() * thread_index / num_threads;
+  const size_t end = beam.size() * (thread_index + 1) / num_threads;
+  for (size_t i = begin; i < end; ++i) {
+    const State &state = beam[i];
     Bitboard remaining_moves = state.position.valid_moves();
     while (remaining_moves) {
       const Move move = first_square(remaining_moves);
       remaining_moves = reset_bit(remaining_moves, move);
       Position next_position;
       state.position.make_move(move, next_position);
-      const Move opp_move =
-        opponent->choose_move(next_position, PlaySettings{});
+      const Move opp_move = opp.choose_move(next_position, PlaySettings{});
       next_position.make_move(opp_move, next_position);
-      State next_state = get_state(next_position);
-      next_state.middle = state.middle;
+      State next_state = get_state(next_position, opp);
+      next_state.parent = static_cast<std::uint32_t>(i);
+      next_state.move = move;
       if (state_better(next_state, threshold)) {
-        next_beam.push_back(next_state);
-        if (next_beam.size() == next_beam.capacity()) {
-          reduce_next_beam();
+        bool inserted;
+        seen.insert(next_position, inserted, true);
+        if (!inserted) continue;
+        local_beam.push_back(next_state);
+        if (local_beam.size() >= local_limit) {
+          reduce_beam(local_beam, threshold);
         }
       }
     }
   }
-  reduce_next_beam();
-  beam = next_beam;
+  reduce_beam(local_beam, threshold);
+  std::sort(local_beam.begin(), local_beam.end(), state_better);
 }
 
-void FindGames::reduce_next_beam() {
+// Keeps the best beam_size states, in no particular order. What's cut off
+// tightens the shared threshold, and threshold is refreshed from it.
+void FindGames::reduce_beam(std::vector<State> &states, State &threshold) {
+  if (states.empty()) return;
   StateBetter state_better;
-  State &threshold = beam_thresholds[next_beam[0].position.move_number()];
-
-  std::sort(next_beam.begin(), next_beam.end(), state_better);
-  auto p = std::unique(next_beam.begin(), next_beam.end());
-  next_beam.erase(p, next_beam.end());
-  if (next_beam.size() > beam_size) {
-    threshold = next_beam[beam_size];
-    next_beam.resize(beam_size);
+  const int move_number = states[0].position.move_number();
+
+  // Selection runs in parallel; only the threshold is shared.
+  bool cut = false;
+  State cut_off;
+  if (states.size() > beam_size) {
+    std::nth_element(states.begin(), states.begin() + beam_size, states.end(),
+                     state_better);
+    cut = true;
+    cut_off = states[beam_size];
+    states.resize(beam_size);
   }
+
+  std::lock_guard<std::mutex> lg(beam_thresholds_lock);
+  State &shared_threshold = beam_thresholds[move_number];
+  if (cut && state_better(cut_off, shared_threshold)) {
+    shared_threshold = cut_off;
+  }
+  threshold = shared_threshold;
 }
 
-State FindGames::brute_search_beam() {
-  best_game.score = -max_score;
-  Prepared cur_game = best_game;
-  State best_state;
-  for (const State &state : beam) {
-    const Score old_score = best_game.score;
-    brute_search_beam_rec(state.position, cur_game);
-    if (best_game.score > old_score) {
-      best_state = state;
+// local_beams are sorted and distinct. Equal states from different threads
+// are next to each other in the merged order.
+void FindGames::merge_local_beams(std::vector<std::vector<State>> &local_beams) {
+  StateBetter state_better;
+  std::vector<size_t> next_index(local_beams.size(), 0);
+  next_beam.clear();
+  while (next_beam.size() < beam_size) {
+    int best = -1;
+    for (size_t i = 0; i < local_beams.size(); ++i) {
+      if (next_index[i] == local_beams[i].size()) continue;
+      if (best < 0 || state_better(local_beams[i][next_index[i]],
+                                   local_beams[best][next_index[best]])) {
+        best = static_cast<int>(i);
+      }
+    }
+    if (best < 0) break;
+    const State &state = local_beams[best][next_index[best]++];
+    if (next_beam.empty() || !(next_beam.back() == state)) {
+      next_beam.push_back(state);
     }
   }
-  assert(best_game.score > -max_score);
-  return best_state;
+  beam.swap(next_beam);
 }
 
-void FindGames::brute_search_beam_rec(const Position &position,
-                                      Prepared &game) {
+// Index of the state in beam that leads to best_game. The first one if
+// several lead to the best score, and the moves are the first in move order.
+size_t FindGames::brute_search_beam() {
+  brute_scores.assign(beam.size(), -max_score);
+  next_brute_index = 0;
+  best_brute_score = -max_score;
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(&FindGames::brute_search_beam_thread, this, i);
+  }
+  brute_search_beam_thread(0);
+  for (auto &th : threads) {
+    th.join();
+  }
+
+  // A state searched after another one reached the best score may have
+  // only an upper bound equal to it.
+  const Score best_score = static_cast<Score>(best_brute_score.load());
+  assert(best_score > -max_score);
+  size_t best_index = 0;
+  while (brute_scores[best_index] < best_score ||
+         brute_solve(beam[best_index].position,
+                     static_cast<Score>(best_score - 1), *opponent) < best_score) {
+    ++best_index;
+  }
+  best_game.score = best_score;
+  brute_recover(beam[best_index].position, best_score);
+  return best_index;
+}
+
+void FindGames::brute_search_beam_thread(const int thread_index) {
+  Player &opp = *thread_opponents[thread_index];
+  for (;;) {
+    const size_t index = next_brute_index++;
+    if (index >= beam.size()) break;
+    const Score alpha = static_cast<Score>(best_brute_score.load());
+    const Score score = brute_solve(beam[index].position, alpha, opp);
+    brute_scores[index] = score;
+    int best = best_brute_score;
+    while (score > best &&
+           !best_brute_score.compare_exchange_weak(best, score)) {}
+  }
+}
+
+// Best final score for the player to move against opp, which answers every
+// move. Fail-soft: if the result is <= alpha, it's an upper bound.
+Score FindGames::brute_solve(const Position &position, const Score alpha,
+                             Player &opp) {
+  if (position.finished()) return position.final_score();
+
+  // Close to the end, searching is cheaper than a cache miss.
+  const bool use_cache = position.move_number() <= brute_cache_max_move_number;
+  Score lower;
+  Score upper;
+  if (use_cache && brute_cache.find(position, lower, upper)) {
+    if (lower == upper || upper <= alpha) return upper;
+  }
+
+  // The opponent's stable stones stay theirs.
+  const Score bound = static_cast<Score>(
+      num_squares / 2 - count_squares(position.opponent & stable_squares(position)));
+  if (bound <= alpha) return bound;
+
+  Score best = -max_score;
+  Bitboard remaining_moves = position.valid_moves();
+  while (remaining_moves && best < bound) {
+    const Move move = first_square(remaining_moves);
+    remaining_moves = reset_bit(remaining_moves, move);
+    Move opp_move;
+    const Score score =
+      brute_move_score(position, move, std::max(alpha, best), opp, opp_move);
+    best = std::max(best, score);
+  }
+  if (use_cache) brute_cache.store(position, best, alpha, max_score);
+  return best;
+}
+
+Score FindGames::brute_move_score(const Position &position, const Move move,
+                                  const Score alpha, Player &opp,
+                                  Move &opp_move) {
+  Position next_position;
+  position.make_move(move, next_position);
+  if (next_position.finished()) {
+    opp_move = invalid_move;
+    return static_cast<Score>(-next_position.final_score());
+  }
+  opp_move = opp.choose_move(next_position, PlaySettings{});
+  next_position.make_move(opp_move, next_position);
+  return brute_solve(next_position, alpha, opp);
+}
+
+// Fills in best_game.moves from position, which leads to score.
+void FindGames::brute_recover(const Position &position, const Score score) {
   if (position.finished()) {
-    game.score = position.final_score();
-    if (game.score > best_game.score) {
-      best_game = game;
-    }
-  } else {
-    const int move_number = position.move_number();
-    Bitboard remaining_moves = position.valid_moves();
-    while (remaining_moves) {
-      const Move move = first_square(remaining_moves);
-      game.moves[move_number] = move;
-      remaining_moves = reset_bit(remaining_moves, move);
-      Position next_position;
-      position.make_move(move, next_position);
-      if (next_position.finished()) {
-        game.score = -next_position.final_score();
-        if (game.score > best_game.score) {
-          best_game = game;
-        }
-      } else {
-        const Move opp_move =
-          opponent->choose_move(next_position, PlaySettings{});
-        game.moves[move_number+1] = opp_move;
-        next_position.make_move(opp_move, next_position);
-        brute_search_beam_rec(next_position, game);
-      }
+    assert(position.final_score() == score);
+    return;
+  }
+  const int move_number = position.move_number();
+  Bitboard remaining_moves = position.valid_moves();
+  while (remaining_moves) {
+    const Move move = first_square(remaining_moves);
+    remaining_moves = reset_bit(remaining_moves, move);
+    Move opp_move;
+    if (brute_move_score(position, move, static_cast<Score>(score - 1),
+                         *opponent, opp_move) < score) {
+      continue;
     }
+    best_game.moves[move_number] = move;
+    if (opp_move == invalid_move) return;
+    best_game.moves[move_number + 1] = opp_move;
+    Position next_position;
+    position.make_move(move, next_position);
+    next_position.make_move(opp_move, next_position);
+    brute_recover(next_position, score);
+    return;
   }
+  assert(false);
 }
 
-void FindGames::recover_moves(const Position &position1,
-                              const Position &position2) {
-  const int pos1mn = position1.move_number();
-  const int pos2mn = position2.move_number();
-  log_info("recovering moves %d-%d\n", pos1mn, pos2mn);
-  assert(pos2mn - pos1mn > 0 && (pos2mn-pos1mn) % 2 == 0);
-  if (pos2mn - pos1mn == 2) {
-    Bitboard remaining_moves = position1.valid_moves();
-    while (remaining_moves) {
-      const Move move = first_square(remaining_moves);
-      remaining_moves = reset_bit(remaining_moves, move);
-      Position next_position;
-      position1.make_move(move, next_position);
-      const Move opp_move =
-        opponent->choose_move(next_position, PlaySettings{});
-      next_position.make_move(opp_move, next_position);
-      if (next_position == position2) {
-        best_game.moves[pos1mn] = move;
-        best_game.moves[pos1mn + 1] = opp_move;
-        break;
-      }
-    }
-    assert(best_game.moves[pos1mn] != invalid_move);
-  } else {
-    const int middle_move_number = pos1mn + 2 * ((pos2mn-pos1mn) / 4);
-
-    beam.clear();
-    beam.push_back(get_state(position1));
-    while (beam[0].position.move_number() != pos2mn) {
-      if (beam[0].position.move_number() == middle_move_number) {
-        for (State &state : beam) {
-          state.middle = state.position;
-        }
-      }
-      advance_beam();
-    }
+// Fills in best_game.moves from start_position to beam[index].
+void FindGames::recover_moves(const Position &start_position, size_t index) {
+  const Position &end_position = beam[index].position;
+  std::vector<Move> moves(beam_links.size());
+  for (size_t level = beam_links.size(); level-- > 0;) {
+    const BeamLink &link = beam_links[level][index];
+    moves[level] = link.move;
+    index = link.parent;
+  }
+  assert(index == 0);
 
-    Position middle;
-    for (const State &state : beam) {
-      if (state.position == position2) {
-        middle = state.middle;
-        break;
-      }
-    }
-    assert(middle.move_number() == middle_move_number);
-    recover_moves(position1, middle);
-    recover_moves(middle, position2);
+  Position position = start_position;
+  for (const Move move : moves) {
+    const int move_number = position.move_number();
+    position.make_move(move, position);
+    const Move opp_move = opponent->choose_move(position, PlaySettings{});
+    position.make_move(opp_move, position);
+    best_game.moves[move_number] = move;
+    best_game.moves[move_number + 1] = opp_move;
   }
+  assert(position == end_position);
 }
 
-State FindGames::get_state(const Position &position) {
+State FindGames::get_state(const Position &position, Player &opp) {
   State state;
   state.position = position;
-  state.value = evaluate_rec(position, depth);
+  state.value = evaluate_rec(position, depth, opp);
   return state;
 }
 
-Milliscore FindGames::evaluate_rec(const Position &position, int d) {
+Milliscore FindGames::evaluate_rec(const Position &position, int d,
+                                   Player &opp) {
   if (d<=0) return evaluate(position);
   Milliscore eval = -max_milliscore;
   Bitboard remaining_moves = position.valid_moves();
@@ -340,9 +535,9 @@ Milliscore FindGames::evaluate_rec(const Position &position, int d) {
     remaining_moves = reset_bit(remaining_moves, move);
     Position next_position;
     position.make_move(move, next_position);
-    const Move opp_move = opponent->choose_move(next_position, PlaySettings{});
+    const Move opp_move = opp.choose_move(next_position, PlaySettings{});
     next_position.make_move(opp_move, next_position);
-    eval = std::max(eval, evaluate_rec(next_position, d-2));
+    eval = std::max(eval, evaluate_rec(next_position, d-2, opp));
   }
   return eval;
 }
@@ -363,6 +558,8 @@ void FindGames::print() {
 int main(int argc, char **argv) {
   init_hashing();
   init_evaluator();
+  init_book();
+  init_prepared();
   FindGames find_games{argc, argv};
   find_games.go();
 }
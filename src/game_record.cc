@@ -0,0 +1,151 @@
+#include "game_record.h"
+#include "logging.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+  constexpr char game_record_magic[8] = {'F','L','G','R','0','0','0','1'};
+
+  struct RecordHeader {
+    std::uint64_t player;
+    std::uint64_t opponent;
+    std::uint8_t num_moves;
+    std::int8_t white_player;
+    std::uint8_t padding[6];
+  };
+  static_assert(sizeof(RecordHeader) == 24, "");
+
+  constexpr std::size_t max_record_size =
+    sizeof(RecordHeader) + num_squares * sizeof(GameRecordMove);
+}
+
+std::int16_t GameRecordMove::score_from_milliscore(const Milliscore milliscore) {
+  const Milliscore score = milliscore >> (milliscore_bits - 8);
+  return static_cast<std::int16_t>(std::min(std::max(score, Milliscore{-32767}),
+                                            Milliscore{32767}));
+}
+
+void GameRecord::add_move(const Move move,
+                          const Player &player,
+                          const Duration think_time) {
+  assert(num_moves < num_squares);
+  GameRecordMove &record_move = moves[num_moves++];
+  record_move.move = move;
+  record_move.depth = static_cast<std::int8_t>(player.get_last_move_depth());
+  record_move.score =
+    GameRecordMove::score_from_milliscore(player.get_last_move_milliscore());
+  record_move.think_time = static_cast<std::uint32_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(think_time).count());
+}
+
+Position GameRecord::position_before(const int i) const {
+  assert(i >= 0 && i <= num_moves);
+  Position position = start;
+  for (int j = 0; j < i; ++j) {
+    position.make_move(moves[j].move, position);
+  }
+  return position;
+}
+
+GameRecordWriter::~GameRecordWriter() {
+  if (fd >= 0) close(fd);
+}
+
+bool GameRecordWriter::open(const std::string &_file_name) {
+  assert(fd < 0);
+  file_name = _file_name;
+  fd = ::open(file_name.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0644);
+  if (fd < 0) {
+    log_always("%s: can't open\n", file_name.c_str());
+    return false;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    log_always("%s: can't stat\n", file_name.c_str());
+    return false;
+  }
+  if (file_stat.st_size == 0 &&
+      ::write(fd, game_record_magic, sizeof(game_record_magic)) !=
+        static_cast<ssize_t>(sizeof(game_record_magic))) {
+    log_always("%s: write failed\n", file_name.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool GameRecordWriter::write(const GameRecord &record) {
+  assert(fd >= 0);
+  assert(record.num_moves >= 0 && record.num_moves <= num_squares);
+
+  char buffer[max_record_size];
+  RecordHeader header{};
+  header.player = record.start.player;
+  header.opponent = record.start.opponent;
+  header.num_moves = static_cast<std::uint8_t>(record.num_moves);
+  header.white_player = record.white_player;
+  std::memcpy(buffer, &header, sizeof(header));
+  const std::size_t moves_size = record.num_moves * sizeof(GameRecordMove);
+  std::memcpy(buffer + sizeof(header), record.moves, moves_size);
+
+  const std::size_t size = sizeof(header) + moves_size;
+  if (::write(fd, buffer, size) != static_cast<ssize_t>(size)) {
+    log_always("%s: write failed\n", file_name.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool GameRecordReader::open(const std::string &_file_name) {
+  file_name = _file_name;
+  f.open(file_name, std::ios::binary);
+  char magic[sizeof(game_record_magic)];
+  if (!f.read(magic, sizeof(magic)) ||
+      !std::equal(magic, magic + sizeof(magic), game_record_magic)) {
+    log_always("%s: not a game record file\n", file_name.c_str());
+    return false;
+  }
+  return true;
+}
+
+bool GameRecordReader::read(GameRecord &record) {
+  RecordHeader header;
+  if (!f.read(reinterpret_cast<char*>(&header), sizeof(header))) return false;
+  if (header.num_moves > num_squares) {
+    log_always("%s: record %ld is corrupt\n", file_name.c_str(), records_read);
+    return false;
+  }
+  if (header.player & header.opponent) {
+    log_always("%s: record %ld is corrupt\n", file_name.c_str(), records_read);
+    return false;
+  }
+  record.start = Position{header.player, header.opponent};
+  record.white_player = header.white_player;
+  record.num_moves = header.num_moves;
+  if (!f.read(reinterpret_cast<char*>(record.moves),
+              record.num_moves * sizeof(GameRecordMove))) {
+    return false;
+  }
+
+  Position position = record.start;
+  for (int i = 0; i < record.num_moves; ++i) {
+    const Move move = record.moves[i].move;
+    if (move < 0 || move >= num_squares ||
+        !get_bit(position.valid_moves(), move)) {
+      log_always("%s: record %ld has an invalid move\n",
+                 file_name.c_str(), records_read);
+      return false;
+    }
+    position.make_move(move, position);
+  }
+  if (!position.finished()) {
+    log_always("%s: record %ld is unfinished\n",
+               file_name.c_str(), records_read);
+    return false;
+  }
+  ++records_read;
+  return true;
+}
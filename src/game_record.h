@@ -0,0 +1,90 @@
+#ifndef GAME_RECORD_H
+#define GAME_RECORD_H
+
+#include "arch.h"
+#include "clock.h"
+#include "evaluator.h"
+#include "player.h"
+#include "position.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+// A played game: the starting position and, for every move, what the player
+// reported about its search.
+//
+// File format: the magic "FLGR0001", then records of:
+//   player, opponent bitboards of the starting position: 2 x uint64
+//   num_moves: uint8
+//   white_player: int8
+//   padding: 6 bytes
+//   num_moves x GameRecordMove
+// Little endian, like everything else these tools write.
+struct GameRecordMove {
+  Move move = invalid_move;
+  // 0 for book moves and players that don't search.
+  std::int8_t depth = 0;
+  // For the player to move, in 1/256 of a disc.
+  std::int16_t score = 0;
+  // Microseconds.
+  std::uint32_t think_time = 0;
+
+  static std::int16_t score_from_milliscore(Milliscore milliscore);
+  Milliscore milliscore() const { return Milliscore{score} * (1 << (milliscore_bits - 8)); }
+};
+static_assert(sizeof(GameRecordMove) == 8, "");
+
+struct GameRecord {
+  Position start;
+  // Which player of the match played white, the color to move at even move
+  // numbers. 0 outside of matches.
+  std::int8_t white_player = 0;
+  int num_moves = 0;
+  GameRecordMove moves[num_squares];
+
+  // With what player reports about the search that chose move.
+  void add_move(Move move, const Player &player, Duration think_time);
+
+  // Position before moves[i]. i == num_moves is the final position.
+  Position position_before(int i) const;
+};
+
+// Appends to the file, creating it if needed. Thread-safe: every record is
+// a single write to a file opened with O_APPEND, so records from concurrent
+// threads or processes don't interleave, and the caller only pays for one
+// small system call per game.
+class GameRecordWriter {
+public:
+  GameRecordWriter() = default;
+  GameRecordWriter(const GameRecordWriter &) = delete;
+  GameRecordWriter &operator=(const GameRecordWriter &) = delete;
+  ~GameRecordWriter();
+
+  bool open(const std::string &file_name);
+  bool is_open() const { return fd >= 0; }
+  bool write(const GameRecord &record);
+
+private:
+  std::string file_name;
+  int fd = -1;
+};
+
+class GameRecordReader {
+public:
+  bool open(const std::string &file_name);
+
+  // False at the end of the file. A truncated last record, e.g. from a
+  // killed match, is treated as the end of the file. Invalid positions or
+  // moves, and games that don't reach the end, are reported and stop
+  // reading.
+  bool read(GameRecord &record);
+
+  long num_read() const { return records_read; }
+
+private:
+  std::string file_name;
+  std::ifstream f;
+  long records_read = 0;
+};
+
+#endif
@@ -0,0 +1,107 @@
+#include "game_record.h"
+#include "random.h"
+#include "tests.h"
+#include <cstdio>
+#include <fstream>
+
+TEST(test_game_record_file) {
+  const std::string file_name = "game_record_test.tmp";
+  std::remove(file_name.c_str());
+
+  RandomGenerator rng;
+  GameRecord records[3];
+  for (int r = 0; r < 3; ++r) {
+    GameRecord &record = records[r];
+    Position pos = Position::initial();
+    for (int i = 0; i < 2 * r; ++i) {
+      pos.make_move(rng.get_square(pos.valid_moves()), pos);
+    }
+    record.start = pos;
+    record.white_player = static_cast<std::int8_t>(r % 2);
+    while (!pos.finished()) {
+      GameRecordMove &move = record.moves[record.num_moves++];
+      move.move = rng.get_square(pos.valid_moves());
+      move.depth = static_cast<std::int8_t>(record.num_moves);
+      move.score = GameRecordMove::score_from_milliscore(
+          (record.num_moves - 30) * (1 << (milliscore_bits - 2)));
+      move.think_time = 1000u * record.num_moves;
+      pos.make_move(move.move, pos);
+    }
+    assert(record.position_before(record.num_moves) == pos);
+  }
+
+  // Two writers append to the same file.
+  {
+    GameRecordWriter writer;
+    assert(writer.open(file_name));
+    assert(writer.write(records[0]));
+  }
+  {
+    GameRecordWriter writer;
+    assert(writer.open(file_name));
+    assert(writer.write(records[1]));
+    assert(writer.write(records[2]));
+  }
+  // Truncated record at the end.
+  {
+    std::ofstream f(file_name, std::ios::binary | std::ios::app);
+    f.write("xyz", 3);
+  }
+
+  GameRecordReader reader;
+  assert(reader.open(file_name));
+  GameRecord record;
+  for (int r = 0; r < 3; ++r) {
+    assert(reader.read(record));
+    assert(record.start == records[r].start);
+    assert(record.white_player == records[r].white_player);
+    assert(record.num_moves == records[r].num_moves);
+    assert(record.num_moves == num_squares - 4 - 2 * r);
+    for (int i = 0; i < record.num_moves; ++i) {
+      assert(record.moves[i].move == records[r].moves[i].move);
+      assert(record.moves[i].depth == records[r].moves[i].depth);
+      assert(record.moves[i].score == records[r].moves[i].score);
+      assert(record.moves[i].think_time == records[r].moves[i].think_time);
+    }
+  }
+  assert(records[0].moves[0].milliscore() == -29 * (1 << (milliscore_bits - 2)));
+  assert(!reader.read(record));
+  assert(reader.num_read() == 3);
+  std::remove(file_name.c_str());
+}
+
+TEST(test_game_record_file_invalid) {
+  const std::string file_name = "game_record_test.tmp";
+  RandomGenerator rng;
+  GameRecord finished;
+  finished.start = Position::initial();
+  Position pos = finished.start;
+  while (!pos.finished()) {
+    const Move move = rng.get_square(pos.valid_moves());
+    finished.moves[finished.num_moves++].move = move;
+    pos.make_move(move, pos);
+  }
+
+  GameRecord unfinished = finished;
+  unfinished.num_moves = 10;
+  GameRecord overlapping = finished;
+  overlapping.start.opponent |= overlapping.start.player;
+
+  for (const GameRecord *const bad : {&unfinished, &overlapping}) {
+    std::remove(file_name.c_str());
+    {
+      GameRecordWriter writer;
+      assert(writer.open(file_name));
+      assert(writer.write(finished));
+      assert(writer.write(*bad));
+      assert(writer.write(finished));
+    }
+    GameRecordReader reader;
+    assert(reader.open(file_name));
+    GameRecord record;
+    assert(reader.read(record));
+    assert(!reader.read(record));
+    assert(reader.num_read() == 1);
+  }
+  std::remove(file_name.c_str());
+}
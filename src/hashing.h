@@ -2,12 +2,14 @@
 #define HASHING_H
 
 #include "arch.h"
+#include "large_memory.h"
 #include "logging.h"
 #include "position.h"
 #include <cassert>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <type_traits>
 
 void init_hashing();
 
@@ -15,10 +17,18 @@ using Hash = std::uint32_t;
 
 Hash hash_position(const Position &position);
 
+// Open addressing with linear probing.
+//
+// A growable table doubles its number of buckets when it is full instead of
+// running out of memory. Entries are migrated to the bigger array a few
+// buckets at a time on subsequent inserts, so no single insert pays for the
+// whole rehash. Until migration finishes both arrays are allocated, and an
+// insert may move values: in a growable table, pointers returned by find and
+// insert are only valid until the next insert.
 template<typename Value>
 class PositionHashTable {
 public:
-  explicit PositionHashTable(std::size_t buckets);
+  explicit PositionHashTable(std::size_t buckets, bool growable = false);
   ~PositionHashTable();
 
   Value *find(const Position &position) {
@@ -35,6 +45,7 @@ public:
   std::size_t size() const {  return m_size; }
   std::size_t limit() const {  return m_limit; }
 
+  // A growable table resets the limit to the new capacity when it grows.
   void set_limit(const std::size_t _limit) {
     assert(_limit <= m_capacity);
     m_limit = _limit;
@@ -43,100 +54,232 @@ public:
 
   bool out_of_memory() const {  return m_out_of_memory; }
 
+  // Remove all entries. Takes time proportional to the number of buckets.
+  void clear();
+
+  // Including the old array while a migration is in progress.
+  std::size_t memory_bytes() const {
+    return (m_mask + 1u + (old_entries ? old_mask + 1u : 0u)) * sizeof(Entry);
+  }
+
+  bool migrating() const { return old_entries != nullptr; }
+
 private:
   struct Entry {
+    enum State : std::uint8_t {
+      empty = 0,
+      full = 1,
+      // Only in the old array during migration. The position stays so that
+      // probe sequences through it aren't broken.
+      moved = 2,
+    };
+
     Entry() {}
     ~Entry() {
-      if (valid) value.~Value();
+      if (state == full) value.~Value();
     }
 
     Position position;
     union {
       Value value;
     };
-    bool valid = false;
+    State state = empty;
   };
 
+  // Old buckets migrated per insert. A table grows when it's 15/16 full
+  // and the new array has room for 15/16 of the old number of buckets
+  // before it is full again, so 2 is enough to always finish in time.
+  static constexpr std::size_t migration_step = 2;
+
+  static Entry *allocate_entries(std::size_t buckets);
+  static void free_entries(Entry *entries, std::size_t buckets);
+
+  // The entry with the position, or the empty entry where it would go.
+  static Entry *probe(Entry *entries, std::size_t mask, const Position &position);
+
+  bool grow();
+  void migrate(std::size_t num_buckets);
+
   std::size_t m_mask;
   std::size_t m_capacity;
   std::size_t m_size;
   std::size_t m_limit;
   bool m_out_of_memory;
+  bool m_growable;
   Entry *entries;
 
+  // Array being migrated from.
+  Entry *old_entries = nullptr;
+  std::size_t old_mask = 0;
+  std::size_t migrate_next = 0;
+
 public:
   static constexpr std::size_t sizeof_entry = sizeof(Entry);
 
 };
 
 template<typename Value>
-PositionHashTable<Value>::PositionHashTable(const std::size_t buckets) :
+PositionHashTable<Value>::PositionHashTable(const std::size_t buckets,
+                                            const bool growable) :
     m_mask{buckets-1u},
     m_capacity{buckets / 16u * 15u},
     m_size{0},
     m_limit{m_capacity},
-    m_out_of_memory{false}
+    m_out_of_memory{false},
+    m_growable{growable}
 {
   assert(buckets >= 16 &&
          buckets <= std::numeric_limits<std::uint32_t>::max() &&
          (buckets & (buckets-1u))==0);
 
-  void *memptr = nullptr;
-  const size_t bytes = buckets * sizeof(Entry);
-  static_assert(64 % alignof(Entry) == 0, "");
-  int ret = posix_memalign(&memptr, 64, bytes);
-  assert(ret==0);
-  entries = reinterpret_cast<Entry*>(memptr);
+  entries = allocate_entries(buckets);
   assert(entries);
-  for (size_t i=0; i<buckets; ++i)
-    new (entries+i) Entry{};
 
   log_info("PositionHashTable allocated %.2f MB\n",
-      static_cast<double>(bytes) / (1<<20));
+      static_cast<double>(buckets * sizeof(Entry)) / (1<<20));
 }
 
 template<typename Value>
 PositionHashTable<Value>::~PositionHashTable() {
+  free_entries(entries, m_mask + 1u);
+  if (old_entries) free_entries(old_entries, old_mask + 1u);
+}
+
+template<typename Value>
+typename PositionHashTable<Value>::Entry *
+PositionHashTable<Value>::allocate_entries(const std::size_t buckets) {
+  static_assert(64 % alignof(Entry) == 0, "");
+  // Memory comes zero-filled, which is what Entry{} is: an empty entry
+  // for the all-empty position. No need to touch every page here.
+  return reinterpret_cast<Entry*>(allocate_large(buckets * sizeof(Entry)));
+}
+
+template<typename Value>
+void PositionHashTable<Value>::free_entries(Entry *const entries,
+                                            const std::size_t buckets) {
+  if (!std::is_trivially_destructible<Value>::value) {
+    for (size_t i=0; i<buckets; ++i) {
+      entries[i].~Entry();
+    }
+  }
+  free_large(entries, buckets * sizeof(Entry));
+}
+
+template<typename Value>
+void PositionHashTable<Value>::clear() {
   for (size_t i=0; i<=m_mask; ++i) {
-    entries[i].~Entry();
+    Entry &entry = entries[i];
+    if (entry.state == Entry::full) {
+      entry.value.~Value();
+      entry.state = Entry::empty;
+    }
+  }
+  if (old_entries) {
+    free_entries(old_entries, old_mask + 1u);
+    old_entries = nullptr;
   }
-  std::free(entries);
+  m_size = 0;
+  m_out_of_memory = false;
 }
 
 template<typename Value>
-const Value *PositionHashTable<Value>::find(const Position &position) const {
-  std::size_t pos = hash_position(position) & m_mask;
+typename PositionHashTable<Value>::Entry *
+PositionHashTable<Value>::probe(Entry *const entries,
+                                const std::size_t mask,
+                                const Position &position) {
+  std::size_t pos = hash_position(position) & mask;
   for (;;) {
-    const Entry &entry = entries[pos];
-    if (!entry.valid) return nullptr;
-    if (entry.position == position) return &entry.value;
-    pos = (pos + 1u) & m_mask;
+    Entry &entry = entries[pos];
+    if (entry.state == Entry::empty || entry.position == position) return &entry;
+    pos = (pos + 1u) & mask;
+  }
+}
+
+template<typename Value>
+const Value *PositionHashTable<Value>::find(const Position &position) const {
+  const Entry *entry = probe(entries, m_mask, position);
+  if (entry->state == Entry::full) return &entry->value;
+  if (old_entries) {
+    entry = probe(old_entries, old_mask, position);
+    if (entry->state == Entry::full) return &entry->value;
   }
+  return nullptr;
 }
 
 template<typename Value>
 template<typename... Args>
 Value *PositionHashTable<Value>::insert(const Position &position, bool &inserted, Args&&... args) {
-  std::size_t pos = hash_position(position) & m_mask;
-  for (;;) {
-    Entry &entry = entries[pos];
-    if (!entry.valid) {
-      if (m_size >= m_limit) {
-        m_out_of_memory = true;
-        inserted = false;
-        return nullptr;
-      }
-      entry.position = position;
-      entry.valid = true;
-      ++m_size;
-      inserted = true;
-      return new(&entry.value) Value(std::forward<Args>(args)...);
+  if (old_entries) migrate(migration_step);
+
+  Entry *entry = probe(entries, m_mask, position);
+  if (entry->state == Entry::full) {
+    inserted = false;
+    return &entry->value;
+  }
+  if (old_entries) {
+    Entry *const old_entry = probe(old_entries, old_mask, position);
+    if (old_entry->state == Entry::full) {
+      inserted = false;
+      return &old_entry->value;
     }
-    if (entry.position == position) {
+  }
+
+  if (m_size >= m_limit) {
+    if (!m_growable || !grow()) {
+      m_out_of_memory = true;
       inserted = false;
-      return &entry.value;
+      return nullptr;
     }
-    pos = (pos + 1u) & m_mask;
+    entry = probe(entries, m_mask, position);
+  }
+
+  entry->position = position;
+  entry->state = Entry::full;
+  ++m_size;
+  inserted = true;
+  return new(&entry->value) Value(std::forward<Args>(args)...);
+}
+
+template<typename Value>
+bool PositionHashTable<Value>::grow() {
+  // Migration normally finishes long before the table is full again.
+  if (old_entries) migrate(old_mask + 1u);
+
+  const std::size_t buckets = 2u * (m_mask + 1u);
+  if (buckets > std::numeric_limits<std::uint32_t>::max()) return false;
+  Entry *const new_entries = allocate_entries(buckets);
+  if (!new_entries) return false;
+
+  old_entries = entries;
+  old_mask = m_mask;
+  migrate_next = 0;
+  entries = new_entries;
+  m_mask = buckets - 1u;
+  m_capacity = buckets / 16u * 15u;
+  m_limit = m_capacity;
+
+  log_verbose("PositionHashTable grew to %.2f MB\n",
+      static_cast<double>(buckets * sizeof(Entry)) / (1<<20));
+  return true;
+}
+
+template<typename Value>
+void PositionHashTable<Value>::migrate(std::size_t num_buckets) {
+  for (; num_buckets > 0 && migrate_next <= old_mask; --num_buckets) {
+    Entry &old_entry = old_entries[migrate_next++];
+    if (old_entry.state != Entry::full) continue;
+    Entry *const entry = probe(entries, m_mask, old_entry.position);
+    // insert never adds a position to the new array while it's in the old one.
+    assert(entry->state == Entry::empty);
+    entry->position = old_entry.position;
+    new(&entry->value) Value(std::move(old_entry.value));
+    entry->state = Entry::full;
+    old_entry.value.~Value();
+    old_entry.state = Entry::moved;
+  }
+  if (migrate_next > old_mask) {
+    free_entries(old_entries, old_mask + 1u);
+    old_entries = nullptr;
   }
 }
 
@@ -1,5 +1,7 @@
 #include "hashing.h"
+#include "random.h"
 #include "tests.h"
+#include <vector>
 
 TEST(test_hash_position) {
   assert(hash_position(Position::initial()) != 0);
@@ -67,9 +69,15 @@ TEST(test_position_hash_destructor) {
     assert(inserted);
     table.insert(Position::initial(), inserted);
     assert(!inserted);
+    table.clear();
+    assert(A::destructor_count == 1);
+    assert(table.size() == 0);
+    assert(!table.find(Position::initial()));
+    table.insert(Position::initial(), inserted);
+    assert(inserted);
   }
-  assert(A::constructor_count == 1);
-  assert(A::destructor_count == 1);
+  assert(A::constructor_count == 2);
+  assert(A::destructor_count == 2);
 }
 
 TEST(test_position_hash_limit) {
@@ -106,3 +114,42 @@ TEST(test_position_hash_limit) {
   assert(inserted && *p == 2);
   assert(!table.out_of_memory());
 }
+
+TEST(test_position_hash_growable) {
+  RandomGenerator rng{1};
+  std::vector<Position> positions;
+  while (positions.size() < 5000) {
+    const Bitboard player = rng.get_bitboard();
+    positions.push_back(Position{player, rng.get_bitboard() & ~player});
+  }
+
+  PositionHashTable<int> table(16, true);
+  bool seen_migrating = false;
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    bool inserted;
+    int *p = table.insert(positions[i], inserted, static_cast<int>(i));
+    assert(inserted && *p == static_cast<int>(i));
+    seen_migrating = seen_migrating || table.migrating();
+    // Entries not migrated yet are still found, and not inserted twice.
+    const std::size_t j = rng.get_int(static_cast<int>(i + 1));
+    p = table.insert(positions[j], inserted, -1);
+    assert(!inserted && *p == static_cast<int>(j));
+  }
+  assert(seen_migrating);
+  assert(table.size() == positions.size());
+  assert(!table.out_of_memory());
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    const int *p = table.find(positions[i]);
+    assert(p && *p == static_cast<int>(i));
+  }
+
+  // Clear in the middle of a migration.
+  while (!table.migrating()) {
+    const Bitboard player = rng.get_bitboard();
+    bool inserted;
+    table.insert(Position{player, rng.get_bitboard() & ~player}, inserted, 0);
+  }
+  table.clear();
+  assert(table.size() == 0 && !table.migrating());
+  assert(!table.find(positions[0]));
+}
@@ -0,0 +1,94 @@
+#include "large_memory.h"
+#include "logging.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+  constexpr std::size_t huge_page_size = std::size_t{2} << 20;
+  // Smaller blocks come from the heap: a mapping of their own would cost a
+  // whole huge page and a system call pair each.
+  constexpr std::size_t min_mapped_bytes = 4 * huge_page_size;
+
+  std::size_t round_up(const std::size_t bytes, const std::size_t unit) {
+    return (bytes + unit - 1u) / unit * unit;
+  }
+
+#if defined(__linux__) && !defined(SUBMISSION)
+  // Best effort, errors are ignored. Calls the kernel directly so we don't
+  // need libnuma.
+  void prefer_local_numa_node(void *const p, const std::size_t bytes) {
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return;
+    constexpr int mpol_preferred = 1;
+    constexpr unsigned long max_node = 8 * sizeof(unsigned long);
+    if (node >= max_node) return;
+    const unsigned long node_mask = 1ul << node;
+    syscall(SYS_mbind, p, bytes, mpol_preferred, &node_mask, max_node, 0u);
+  }
+#endif
+}
+
+void *allocate_large(const std::size_t bytes) {
+#ifdef __linux__
+  if (bytes < min_mapped_bytes) {
+    void *p = nullptr;
+    if (posix_memalign(&p, 64, bytes) != 0) return nullptr;
+    std::memset(p, 0, bytes);
+    return p;
+  }
+  const std::size_t rounded = round_up(bytes, huge_page_size);
+  const char *kind = "huge pages";
+  void *p = mmap(nullptr, rounded, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (p == MAP_FAILED) {
+    // Transparent huge pages only cover aligned 2 MB blocks, so map a bit
+    // more and trim to alignment. Pools are sized as upper bounds, so don't
+    // reserve swap for pages that may never be touched.
+    kind = "transparent huge pages";
+    void *const raw = mmap(nullptr, rounded + huge_page_size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (raw == MAP_FAILED) return nullptr;
+    char *const begin = static_cast<char*>(raw);
+    char *const aligned = reinterpret_cast<char*>(
+        round_up(reinterpret_cast<std::uintptr_t>(begin), huge_page_size));
+    char *const end = begin + rounded + huge_page_size;
+    if (aligned != begin) munmap(begin, aligned - begin);
+    if (aligned + rounded != end) munmap(aligned + rounded, end - (aligned + rounded));
+    p = aligned;
+    if (madvise(p, rounded, MADV_HUGEPAGE) != 0) kind = "normal pages";
+  }
+#ifndef SUBMISSION
+  prefer_local_numa_node(p, rounded);
+#endif
+  log_verbose("allocate_large: %.2f MB in %s\n",
+              static_cast<double>(rounded) / (1<<20), kind);
+  return p;
+#else
+  void *p = nullptr;
+  if (posix_memalign(&p, 64, bytes) != 0) return nullptr;
+  std::memset(p, 0, bytes);
+  return p;
+#endif
+}
+
+void free_large(void *const p, const std::size_t bytes) {
+  if (!p) return;
+#ifdef __linux__
+  if (bytes < min_mapped_bytes) {
+    std::free(p);
+  } else {
+    munmap(p, round_up(bytes, huge_page_size));
+  }
+#else
+  (void) bytes;
+  std::free(p);
+#endif
+}
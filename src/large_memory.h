@@ -0,0 +1,17 @@
+#ifndef LARGE_MEMORY_H
+#define LARGE_MEMORY_H
+
+#include "arch.h"
+#include <cstddef>
+
+// Memory for big tables accessed at random. Tries, in order: explicit huge
+// pages, transparent huge pages, plain pages; prefers the NUMA node of the
+// calling thread. Blocks under a few huge pages come from the heap instead.
+// Always zero-filled and at least 64-byte aligned.
+// Returns nullptr on failure.
+void *allocate_large(std::size_t bytes);
+
+// bytes must be the same as passed to allocate_large.
+void free_large(void *p, std::size_t bytes);
+
+#endif
@@ -0,0 +1,16 @@
+#include "large_memory.h"
+#include "tests.h"
+#include <cstdint>
+
+TEST(test_allocate_large) {
+  // From the heap and mapped.
+  for (const std::size_t bytes : {std::size_t{1000}, std::size_t{20} << 20}) {
+    unsigned char *const p = static_cast<unsigned char*>(allocate_large(bytes));
+    assert(p);
+    assert(reinterpret_cast<std::uintptr_t>(p) % 64 == 0);
+    for (std::size_t i = 0; i < bytes; i += 997) assert(p[i] == 0);
+    assert(p[bytes-1] == 0);
+    p[0] = p[bytes-1] = 1;
+    free_large(p, bytes);
+  }
+}
@@ -1,5 +1,8 @@
+#include "book.h"
 #include "clock.h"
+#include "game_record.h"
 #include "logging.h"
+#include "neural_evaluator.h"
 #include "player_ab.h"
 #include "player_deterministic.h"
 #include "player_external.h"
@@ -7,9 +10,15 @@
 #include "player_mcts.h"
 #include "player_random.h"
 #include "position.h"
+#include "prepared.h"
+#include "random.h"
 #include "referee_util.h"
+#include "sprt.h"
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstdlib>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -35,12 +44,30 @@ private:
   std::vector<PlayerFactory> player_factories;
 
   int num_threads = 1;
+  std::size_t mcts_semispace_size = PlayerMcts::default_semispace_size;
   bool both_sides = true;
+  bool seeded = false;
+  bool uses_neural_weights = false;
+  bool neural_weights_loaded = false;
+  // An ab player facing an mcts player looks up and stores endgame solves
+  // in the mcts player's cache.
+  bool share_endgame_cache = false;
 
   bool store_log = false;
+  GameRecordWriter game_records;
+
+  // Stop as soon as the test decides, instead of playing all positions.
+  bool use_sprt = false;
+  double sprt_elo0 = 0.0;
+  double sprt_elo1 = 0.0;
+  double sprt_alpha = 0.05;
+  double sprt_beta = 0.05;
+  std::unique_ptr<Sprt> sprt;
 
   std::mutex data_lock;
   std::vector<Position>::const_iterator next_starting_position;
+  bool stopped;
+  long positions_played;
 
   static constexpr Duration default_time_limit = std::chrono::seconds{1};
   Duration time_limit[2] = {default_time_limit, default_time_limit};
@@ -70,17 +97,27 @@ Match::Match(int argc, char **argv) {
                                     const Duration) {
         return std::make_unique<PlayerMc>();
       });
-    } else if (arg == "mcts") {
+    } else if (arg.substr(0,4) == "mcts") {
+      // mcts<threads>, e.g. mcts4.
+      const int mcts_threads = arg.size() > 4 ? std::stoi(arg.substr(4)) : 1;
+      assert(mcts_threads >= 1);
+      player_factories.push_back([this, mcts_threads](const std::string &,
+                                                      const Position &,
+                                                      const Duration) {
+        return std::make_unique<PlayerMcts>(mcts_threads, mcts_semispace_size);
+      });
+    } else if (arg == "ab") {
       player_factories.push_back([](const std::string &,
                                     const Position &,
                                     const Duration) {
-        return std::make_unique<PlayerMcts>();
+        return std::make_unique<PlayerAB>();
       });
-    } else if (arg == "ab") {
+    } else if (arg == "abnn") {
+      uses_neural_weights = true;
       player_factories.push_back([](const std::string &,
                                     const Position &,
                                     const Duration) {
-        return std::make_unique<PlayerAB>();
+        return std::make_unique<PlayerAB>(PlayerAB::EvaluatorType::neural);
       });
     } else if (arg.substr(0,5) == "first") {
       assert(arg.size() == 6 && arg[5] >= '0' && arg[5] <= '7');
@@ -113,11 +150,49 @@ Match::Match(int argc, char **argv) {
     } else if (arg == "-threads") {
       assert(next < argc);
       num_threads = std::stoi(argv[next++]);
+    } else if (arg == "-mcts_memory") {
+      // MB per semispace.
+      assert(next < argc);
+      mcts_semispace_size = std::stoull(argv[next++]) << 20;
+      assert(mcts_semispace_size <= max_pool_allocator_capacity);
+    } else if (arg == "-seed") {
+      // Generators get consecutive seeds in the order they're created. Game
+      // threads create players in whatever order they're scheduled, so runs
+      // only repeat with -threads 1, and then only for players that don't
+      // depend on timing.
+      assert(next < argc);
+      set_random_seed(std::stoull(argv[next++]));
+      seeded = true;
+    } else if (arg == "-book") {
+      assert(next < argc);
+      if (!load_book_file(argv[next++])) std::exit(1);
+    } else if (arg == "-nn_weights") {
+      assert(next < argc);
+      if (!load_neural_weights(argv[next++])) std::exit(1);
+      neural_weights_loaded = true;
     } else if (arg == "-verbosity") {
       assert(next < argc);
       verbosity = std::stoi(argv[next++]);
+    } else if (arg == "-sprt") {
+      // Elo of player 0 relative to player 1 under H0 and H1.
+      assert(next + 1 < argc);
+      use_sprt = true;
+      sprt_elo0 = std::stod(argv[next++]);
+      sprt_elo1 = std::stod(argv[next++]);
+    } else if (arg == "-sprt_alpha") {
+      assert(next < argc);
+      sprt_alpha = std::stod(argv[next++]);
+    } else if (arg == "-sprt_beta") {
+      assert(next < argc);
+      sprt_beta = std::stod(argv[next++]);
     } else if (arg == "-noswap") {
       both_sides = false;
+    } else if (arg == "-share_endgame_cache") {
+      share_endgame_cache = true;
+    } else if (arg == "-record") {
+      // Append every game to a game record file.
+      assert(next < argc);
+      if (!game_records.open(argv[next++])) std::exit(1);
     } else if (arg == "-log") {
       store_log = true;
     } else if (arg == "-time") {
@@ -141,13 +216,34 @@ Match::Match(int argc, char **argv) {
   }
   
   assert(player_factories.size() == 2);
+  if (uses_neural_weights && !neural_weights_loaded) {
+    // All-zero weights evaluate every position as a draw.
+    log_always("abnn needs -nn_weights\n");
+    std::exit(1);
+  }
   assert(initial_stones >= 4 && initial_stones <= 64);
   assert(num_threads >= 1);
+  if (seeded && num_threads > 1) {
+    log_always("Warning: -seed doesn't make runs with -threads %d repeatable\n",
+               num_threads);
+  }
+
+  if (use_sprt) {
+    sprt = std::make_unique<Sprt>(sprt_elo0, sprt_elo1, sprt_alpha, sprt_beta);
+  }
 }
 
 void Match::play() {
   starting_positions = generate_starting_positions(initial_stones);
+  if (sprt) {
+    // Neighbors in generation order share their first moves, so a prefix
+    // would be a biased sample.
+    RandomGenerator rng;
+    std::shuffle(starting_positions.begin(), starting_positions.end(), rng);
+  }
   next_starting_position = starting_positions.begin();
+  stopped = false;
+  positions_played = 0;
   total_score = 0;
   total_square_score = 0;
   total_white = 0;
@@ -163,7 +259,7 @@ void Match::play() {
     thread.join();
   }
 
-  const double n = starting_positions.size();
+  const double n = positions_played;
   const double mean_score = total_score / n;
   const double var_score = (total_square_score - mean_score * total_score) / (n-1.0) / n;
   const double stddev_score = std::sqrt(var_score);
@@ -175,9 +271,19 @@ void Match::play() {
   printf("White: %.6f +- %.6f\n", 0.5 * mean_white, 0.5 * stddev_white);
 
   printf("Time: %.3f %.3f\n", to_seconds(max_time[0]), to_seconds(max_time[1]));
+
+  if (sprt) {
+    printf("SPRT: %s, LLR %.3f (%.3f, %.3f), %ld positions\n",
+           sprt_result_name(sprt->result()),
+           sprt->llr(), sprt->lower_bound(), sprt->upper_bound(),
+           sprt->num_samples());
+  }
 }
 
 void Match::run_thread() {
+  // Kept across games: constructing a player allocates its tables, and
+  // their pages fault in again during the first game.
+  std::unique_ptr<Player> player[2];
   for (;;) {
     Position starting;
     long game_number = 0;
@@ -188,15 +294,16 @@ void Match::run_thread() {
       log_always("Game %ld/%zu\n",
           game_number,
           starting_positions.size());
-      if (next_starting_position == starting_positions.end()) break;
+      if (stopped || next_starting_position == starting_positions.end()) break;
       starting = *next_starting_position++;
     }
     int score = 0;
     int white = 0;
+    // Player 0: 1 per win, 0.5 per draw.
+    double points = 0.0;
     for (int attempt = 0; attempt < 1 + both_sides; ++attempt) {
-      std::unique_ptr<Player> player[2];
-      
       for (int i = 0; i < 2; ++i) {
+        if (player[i] && player[i]->new_game()) continue;
         std::string log_path = "/dev/null";
         if (store_log) {
           log_path = std::string("/tmp/player") + std::to_string(i) + "." +
@@ -205,9 +312,20 @@ void Match::run_thread() {
         }
         player[i] = player_factories[i](log_path,starting,time_limit[i]);
       }
+      if (share_endgame_cache) {
+        // Again every game: a player may have been replaced.
+        for (int i = 0; i < 2; ++i) {
+          PlayerMcts *const mcts = dynamic_cast<PlayerMcts*>(player[i].get());
+          PlayerAB *const ab = dynamic_cast<PlayerAB*>(player[i^1].get());
+          if (mcts && ab) ab->set_endgame_cache(&mcts->get_endgame_cache());
+        }
+      }
 
       Position pos = starting;
       Duration time_used[2] = {Duration{0}, Duration{0}};
+      GameRecord record;
+      record.start = starting;
+      record.white_player = static_cast<std::int8_t>(attempt);
       while (!pos.finished()) {
         const int to_move = pos.to_move();
         const int who = to_move ^ attempt;
@@ -216,13 +334,18 @@ void Match::run_thread() {
         play_settings.start_time = started_thinking;
         play_settings.time_left = time_limit[who] - time_used[who];
         const Move move = player[who]->choose_move(pos, play_settings);
-        time_used[who] += current_time() - started_thinking;
+        const Duration think_time = current_time() - started_thinking;
+        time_used[who] += think_time;
+        record.add_move(move, *player[who], think_time);
         player[who^1]->opponent_move(pos, move);
         assert(get_bit(pos.valid_moves(), move));
         pos.make_move(move, pos);
       }
+      if (game_records.is_open()) game_records.write(record);
       const int score_white = pos.final_score();
-      if (attempt==0) score += score_white; else score -= score_white;
+      const int score0 = attempt == 0 ? score_white : -score_white;
+      score += score0;
+      points += score0 > 0 ? 1.0 : score0 == 0 ? 0.5 : 0.0;
       white += score_white;
       {
         std::lock_guard<std::mutex> guard(data_lock);
@@ -237,6 +360,19 @@ void Match::run_thread() {
       total_square_score += score * score;
       total_white += white;
       total_square_white += white * white;
+      ++positions_played;
+      // Games that were in progress when the test decided still count in
+      // the totals, but not in the test.
+      if (sprt && !stopped) {
+        sprt->add(points / (1 + both_sides));
+        log_always("Positions %ld: points %.3f LLR %.3f (%.3f, %.3f)\n",
+                   sprt->num_samples(), sprt->mean(), sprt->llr(),
+                   sprt->lower_bound(), sprt->upper_bound());
+        if (sprt->result() != Sprt::Result::undecided) {
+          log_always("SPRT %s\n", sprt_result_name(sprt->result()));
+          stopped = true;
+        }
+      }
     }
   }
 }
@@ -246,6 +382,8 @@ void Match::run_thread() {
 int main(int argc, char **argv) {
   init_hashing();
   init_evaluator();
+  init_book();
+  init_prepared();
   Match match(argc, argv);
   match.play();
 }
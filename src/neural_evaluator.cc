@@ -0,0 +1,114 @@
+#include "neural_evaluator.h"
+#include "logging.h"
+#include <fstream>
+
+NeuralWeights neural_weights;
+
+namespace {
+  constexpr char neural_weights_magic[8] = {'F','L','N','N','0','0','0','1'};
+}
+
+void prepare_neural_weights() {
+  for (int sq = 0; sq < num_squares; ++sq) {
+    for (int i = 0; i < neural_hidden_size; ++i) {
+      neural_weights.flip[sq][i] =
+        neural_weights.own[sq][i] - neural_weights.other[sq][i];
+    }
+  }
+}
+
+bool load_neural_weights(const std::string &file_name) {
+  std::ifstream f(file_name, std::ios::binary);
+  char magic[sizeof(neural_weights_magic)];
+  f.read(magic, sizeof(magic));
+  if (!f || !std::equal(magic, magic + sizeof(magic), neural_weights_magic)) {
+    log_always("%s: not a neural weights file\n", file_name.c_str());
+    return false;
+  }
+  f.read(reinterpret_cast<char*>(neural_weights.hidden_bias),
+         sizeof(neural_weights.hidden_bias));
+  f.read(reinterpret_cast<char*>(neural_weights.own),
+         sizeof(neural_weights.own));
+  f.read(reinterpret_cast<char*>(neural_weights.other),
+         sizeof(neural_weights.other));
+  f.read(reinterpret_cast<char*>(neural_weights.output),
+         sizeof(neural_weights.output));
+  f.read(reinterpret_cast<char*>(neural_weights.output_bias),
+         sizeof(neural_weights.output_bias));
+  if (!f) {
+    log_always("%s: truncated\n", file_name.c_str());
+    return false;
+  }
+  prepare_neural_weights();
+  return true;
+}
+
+bool save_neural_weights(const std::string &file_name) {
+  std::ofstream f(file_name, std::ios::binary);
+  f.write(neural_weights_magic, sizeof(neural_weights_magic));
+  f.write(reinterpret_cast<const char*>(neural_weights.hidden_bias),
+          sizeof(neural_weights.hidden_bias));
+  f.write(reinterpret_cast<const char*>(neural_weights.own),
+          sizeof(neural_weights.own));
+  f.write(reinterpret_cast<const char*>(neural_weights.other),
+          sizeof(neural_weights.other));
+  f.write(reinterpret_cast<const char*>(neural_weights.output),
+          sizeof(neural_weights.output));
+  f.write(reinterpret_cast<const char*>(neural_weights.output_bias),
+          sizeof(neural_weights.output_bias));
+  return static_cast<bool>(f);
+}
+
+void NeuralAccumulator::refresh(const Position &position) {
+  const int to_move = position.to_move();
+  const __m128i *const bias =
+    reinterpret_cast<const __m128i*>(neural_weights.hidden_bias);
+
+  __m128i a[neural_vectors];
+  __m128i b[neural_vectors];
+  for (int i = 0; i < neural_vectors; ++i) {
+    a[i] = bias[i];
+    b[i] = bias[i];
+  }
+
+  Bitboard player = position.player;
+  while (player) {
+    const int sq = first_square(player);
+    player = remove_first_square(player);
+    const __m128i *const own =
+      reinterpret_cast<const __m128i*>(neural_weights.own[sq]);
+    const __m128i *const other =
+      reinterpret_cast<const __m128i*>(neural_weights.other[sq]);
+    for (int i = 0; i < neural_vectors; ++i) {
+      a[i] = _mm_add_epi16(a[i], own[i]);
+      b[i] = _mm_add_epi16(b[i], other[i]);
+    }
+  }
+
+  Bitboard opponent = position.opponent;
+  while (opponent) {
+    const int sq = first_square(opponent);
+    opponent = remove_first_square(opponent);
+    const __m128i *const own =
+      reinterpret_cast<const __m128i*>(neural_weights.own[sq]);
+    const __m128i *const other =
+      reinterpret_cast<const __m128i*>(neural_weights.other[sq]);
+    for (int i = 0; i < neural_vectors; ++i) {
+      a[i] = _mm_add_epi16(a[i], other[i]);
+      b[i] = _mm_add_epi16(b[i], own[i]);
+    }
+  }
+
+  __m128i *const acc_to_move = reinterpret_cast<__m128i*>(values[to_move]);
+  __m128i *const acc_waiting = reinterpret_cast<__m128i*>(values[to_move ^ 1]);
+  for (int i = 0; i < neural_vectors; ++i) {
+    acc_to_move[i] = a[i];
+    acc_waiting[i] = b[i];
+  }
+}
+
+Milliscore neural_evaluate(const Position &position) {
+  NeuralAccumulator accumulator;
+  accumulator.refresh(position);
+  return neural_evaluate(accumulator, position);
+}
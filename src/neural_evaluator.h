@@ -0,0 +1,162 @@
+#ifndef NEURAL_EVALUATOR_H
+#define NEURAL_EVALUATOR_H
+
+#include "evaluator.h"
+#include "position.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <emmintrin.h>
+
+// A small quantized network in the style of NNUE.
+//
+// First layer: for every stone, add own[sq] or other[sq], depending on whether
+// the stone belongs to the perspective's color. We keep one int16 accumulator
+// per color, so a move only needs own/other for the new stone and +-(own-other)
+// for each flipped stone.
+//
+// Second layer: clipped ReLU to [0, 1], then a dot product with output[0]
+// (side to move) and output[1] (other side), plus a bias for the move number.
+
+constexpr int neural_hidden_size = 32;
+constexpr int neural_vectors = neural_hidden_size / 8;
+
+// Accumulator weights are in units of 1/64. Activations are clipped to [0, 64].
+constexpr int neural_activation_bits = 6;
+// Output weights are in units of 1/256 score.
+constexpr int neural_output_bits = 8;
+
+constexpr Milliscore neural_max_milliscore =
+  (num_squares / 2) << milliscore_bits;
+
+struct NeuralWeights {
+  alignas(16) std::int16_t hidden_bias[neural_hidden_size];
+  alignas(16) std::int16_t own[num_squares][neural_hidden_size];
+  alignas(16) std::int16_t other[num_squares][neural_hidden_size];
+  // [0] side to move, [1] other side.
+  alignas(16) std::int16_t output[2][neural_hidden_size];
+  Milliscore output_bias[num_squares+1];
+
+  // own - other, computed by prepare_neural_weights.
+  alignas(16) std::int16_t flip[num_squares][neural_hidden_size];
+};
+
+extern NeuralWeights neural_weights;
+
+// Call after modifying neural_weights directly.
+void prepare_neural_weights();
+
+// Return false on error.
+bool load_neural_weights(const std::string &file_name);
+bool save_neural_weights(const std::string &file_name);
+
+struct NeuralAccumulator {
+  void refresh(const Position &position);
+
+  // position.make_move(move, next_position) must have been done.
+  void update(const NeuralAccumulator &prev,
+              const Position &position,
+              Move move,
+              const Position &next_position);
+
+  // [color], where color 0 is the one to move at even move numbers.
+  alignas(16) std::int16_t values[2][neural_hidden_size];
+};
+
+inline void NeuralAccumulator::update(const NeuralAccumulator &prev,
+                                      const Position &position,
+                                      const Move move,
+                                      const Position &next_position) {
+  const int mover = position.to_move();
+  // Stones of both colors get flipped.
+  const Bitboard flipped =
+    next_position.opponent ^ position.player ^ single_square(move);
+  Bitboard to_mover = flipped & position.opponent;
+  Bitboard to_waiter = flipped & position.player;
+
+  const __m128i *const prev_mover =
+    reinterpret_cast<const __m128i*>(prev.values[mover]);
+  const __m128i *const prev_waiter =
+    reinterpret_cast<const __m128i*>(prev.values[mover ^ 1]);
+  const __m128i *const own =
+    reinterpret_cast<const __m128i*>(neural_weights.own[move]);
+  const __m128i *const other =
+    reinterpret_cast<const __m128i*>(neural_weights.other[move]);
+
+  __m128i a[neural_vectors];
+  __m128i b[neural_vectors];
+  for (int i = 0; i < neural_vectors; ++i) {
+    a[i] = _mm_add_epi16(prev_mover[i], own[i]);
+    b[i] = _mm_add_epi16(prev_waiter[i], other[i]);
+  }
+
+  while (to_mover) {
+    const int sq = first_square(to_mover);
+    to_mover = remove_first_square(to_mover);
+    const __m128i *const flip =
+      reinterpret_cast<const __m128i*>(neural_weights.flip[sq]);
+    for (int i = 0; i < neural_vectors; ++i) {
+      a[i] = _mm_add_epi16(a[i], flip[i]);
+      b[i] = _mm_sub_epi16(b[i], flip[i]);
+    }
+  }
+
+  while (to_waiter) {
+    const int sq = first_square(to_waiter);
+    to_waiter = remove_first_square(to_waiter);
+    const __m128i *const flip =
+      reinterpret_cast<const __m128i*>(neural_weights.flip[sq]);
+    for (int i = 0; i < neural_vectors; ++i) {
+      a[i] = _mm_sub_epi16(a[i], flip[i]);
+      b[i] = _mm_add_epi16(b[i], flip[i]);
+    }
+  }
+
+  __m128i *const next_mover = reinterpret_cast<__m128i*>(values[mover]);
+  __m128i *const next_waiter = reinterpret_cast<__m128i*>(values[mover ^ 1]);
+  for (int i = 0; i < neural_vectors; ++i) {
+    next_mover[i] = a[i];
+    next_waiter[i] = b[i];
+  }
+}
+
+inline Milliscore neural_evaluate(const NeuralAccumulator &accumulator,
+                                  const Position &position) {
+  const int to_move = position.to_move();
+  const __m128i *const acc_to_move =
+    reinterpret_cast<const __m128i*>(accumulator.values[to_move]);
+  const __m128i *const acc_waiting =
+    reinterpret_cast<const __m128i*>(accumulator.values[to_move ^ 1]);
+  const __m128i *const out_to_move =
+    reinterpret_cast<const __m128i*>(neural_weights.output[0]);
+  const __m128i *const out_waiting =
+    reinterpret_cast<const __m128i*>(neural_weights.output[1]);
+
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i one = _mm_set1_epi16(1 << neural_activation_bits);
+
+  __m128i sum = zero;
+  for (int i = 0; i < neural_vectors; ++i) {
+    const __m128i x = _mm_min_epi16(_mm_max_epi16(acc_to_move[i], zero), one);
+    const __m128i y = _mm_min_epi16(_mm_max_epi16(acc_waiting[i], zero), one);
+    sum = _mm_add_epi32(sum, _mm_madd_epi16(x, out_to_move[i]));
+    sum = _mm_add_epi32(sum, _mm_madd_epi16(y, out_waiting[i]));
+  }
+
+  std::int32_t p[4];
+  std::memcpy(p, &sum, 16);
+  const std::int64_t total = std::int64_t{(p[0] + p[1]) + (p[2] + p[3])};
+
+  std::int64_t result =
+    total << (milliscore_bits - neural_activation_bits - neural_output_bits);
+  result += neural_weights.output_bias[position.move_number()];
+  result = std::max<std::int64_t>(result, -neural_max_milliscore);
+  result = std::min<std::int64_t>(result, neural_max_milliscore);
+  return static_cast<Milliscore>(result);
+}
+
+// Non-incremental version.
+Milliscore neural_evaluate(const Position &position);
+
+#endif
@@ -0,0 +1,72 @@
+#include "neural_evaluator.h"
+#include "random.h"
+#include "tests.h"
+
+namespace {
+  void randomize_neural_weights(RandomGenerator &rng) {
+    for (int i = 0; i < neural_hidden_size; ++i) {
+      neural_weights.hidden_bias[i] = rng.get_int(129) - 64;
+      neural_weights.output[0][i] = rng.get_int(513) - 256;
+      neural_weights.output[1][i] = rng.get_int(513) - 256;
+    }
+    for (int sq = 0; sq < num_squares; ++sq) {
+      for (int i = 0; i < neural_hidden_size; ++i) {
+        neural_weights.own[sq][i] = rng.get_int(33) - 16;
+        neural_weights.other[sq][i] = rng.get_int(33) - 16;
+      }
+    }
+    for (int m = 0; m <= num_squares; ++m) {
+      neural_weights.output_bias[m] = (rng.get_int(2001) - 1000) << 10;
+    }
+    prepare_neural_weights();
+  }
+}
+
+TEST(test_neural_accumulator_update) {
+  RandomGenerator rng;
+  randomize_neural_weights(rng);
+
+  for (int game = 0; game < 100; ++game) {
+    Position position = Position::initial();
+    NeuralAccumulator accumulator;
+    accumulator.refresh(position);
+    while (!position.finished()) {
+      const Move move = rng.get_square(position.valid_moves());
+      Position next_position;
+      position.make_move(move, next_position);
+
+      NeuralAccumulator next_accumulator;
+      next_accumulator.update(accumulator, position, move, next_position);
+
+      NeuralAccumulator refreshed;
+      refreshed.refresh(next_position);
+      for (int color = 0; color < 2; ++color) {
+        for (int i = 0; i < neural_hidden_size; ++i) {
+          assert(next_accumulator.values[color][i] == refreshed.values[color][i]);
+        }
+      }
+      assert(neural_evaluate(next_accumulator, next_position) ==
+             neural_evaluate(next_position));
+
+      position = next_position;
+      accumulator = next_accumulator;
+    }
+  }
+
+  neural_weights = NeuralWeights{};
+}
+
+TEST(test_neural_evaluate_output) {
+  // Only the output bias: evaluation is the bias for the move number.
+  neural_weights = NeuralWeights{};
+  neural_weights.output_bias[4] = 3 << milliscore_bits;
+  prepare_neural_weights();
+  assert(neural_evaluate(Position::initial()) == 3 << milliscore_bits);
+
+  // One saturated hidden unit for the side to move.
+  neural_weights.hidden_bias[0] = 1 << neural_activation_bits;
+  neural_weights.output[0][0] = 2 << neural_output_bits;
+  assert(neural_evaluate(Position::initial()) == 5 << milliscore_bits);
+
+  neural_weights = NeuralWeights{};
+}
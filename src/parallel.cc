@@ -0,0 +1,47 @@
+#include "parallel.h"
+#include <cassert>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+void parallel_for(const int num_threads, const long num_items,
+                  const std::function<void(int, long)> &work,
+                  const std::function<void(long)> &done) {
+  assert(num_threads >= 1);
+
+  std::mutex lock;
+  long next_item = 0;
+  // Items in [next_done, num_items) that have finished.
+  std::vector<bool> finished(num_items, false);
+  long next_done = 0;
+
+  const auto run_thread = [&](const int thread) {
+    for (;;) {
+      long item;
+      {
+        std::lock_guard<std::mutex> guard(lock);
+        if (next_item == num_items) break;
+        item = next_item++;
+      }
+
+      work(thread, item);
+
+      std::lock_guard<std::mutex> guard(lock);
+      finished[item] = true;
+      while (next_done < num_items && finished[next_done]) {
+        if (done) done(next_done);
+        ++next_done;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int thread = 1; thread < num_threads; ++thread) {
+    threads.emplace_back(run_thread, thread);
+  }
+  run_thread(0);
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  assert(next_done == num_items);
+}
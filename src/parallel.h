@@ -0,0 +1,20 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "arch.h"
+#include <functional>
+
+// Calls work(thread, item) for every item in [0, num_items) on num_threads
+// threads. Items are handed out in increasing order; thread is in
+// [0, num_threads), so work can keep per-thread state such as a player or
+// accumulators to merge at the end.
+//
+// done(item), if given, is called for every item in increasing order, as
+// soon as that item and all earlier ones have finished, and never
+// concurrently with another done. Output written there is in the same order
+// whatever the number of threads.
+void parallel_for(int num_threads, long num_items,
+                  const std::function<void(int, long)> &work,
+                  const std::function<void(long)> &done = nullptr);
+
+#endif
@@ -0,0 +1,32 @@
+#include "parallel.h"
+#include "tests.h"
+#include <atomic>
+#include <vector>
+
+TEST(test_parallel_for) {
+  for (int num_threads = 1; num_threads <= 4; ++num_threads) {
+    constexpr long num_items = 1000;
+    std::vector<int> item_thread(num_items, -1);
+    std::vector<long> done_order;
+    std::atomic<long> total{0};
+
+    parallel_for(num_threads, num_items,
+      [&](const int thread, const long item) {
+        assert(thread >= 0 && thread < num_threads);
+        assert(item_thread[item] == -1);
+        item_thread[item] = thread;
+        total += item;
+      },
+      [&](const long item) {
+        assert(item_thread[item] != -1);
+        done_order.push_back(item);
+      });
+
+    assert(total == num_items * (num_items - 1) / 2);
+    assert(static_cast<long>(done_order.size()) == num_items);
+    for (long i = 0; i < num_items; ++i) assert(done_order[i] == i);
+  }
+
+  // No items.
+  parallel_for(2, 0, [](int, long) { assert(false); });
+}
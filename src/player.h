@@ -2,6 +2,7 @@
 #define PLAYER_H
 
 #include "clock.h"
+#include "evaluator.h"
 #include "position.h"
 
 struct PlaySettings {
@@ -20,6 +21,15 @@ public:
                            const PlaySettings &settings) = 0;
 
   virtual void opponent_move(const Position &, Move) {}
+
+  // What the search for the last chosen move found, for game records.
+  // Players that don't search report 0.
+  virtual int get_last_move_depth() const { return 0; }
+  virtual Milliscore get_last_move_milliscore() const { return 0; }
+
+  // Forgets the previous game so that the player can be reused for another
+  // one. Returns false if it can't be, and a new player has to be created.
+  virtual bool new_game() { return true; }
 };
 
 #endif
@@ -7,11 +7,34 @@
 #include <algorithm>
 #include <cmath>
 
-PlayerAB::PlayerAB():
-  transposition_table{transposition_table_buckets}
+PlayerAB::PlayerAB(const EvaluatorType _evaluator_type,
+                   const std::size_t _transposition_table_buckets):
+  evaluator_type{_evaluator_type},
+  transposition_table{_transposition_table_buckets}
 {
   for (int i=0;i<num_squares;++i) killer_moves[i] = invalid_move;
-  for (int i=0;i<num_squares;++i) moves_so_far[i] = invalid_move;
+}
+
+bool PlayerAB::new_game() {
+  // Entries from earlier games are recognized by their generation and
+  // overwritten as if the bucket were empty, so that a game isn't searched
+  // faster thanks to the previous one, such as the same start with colors
+  // swapped. Clearing scans every bucket, so only do it when the generation
+  // wraps around or the table is half full.
+  ++generation;
+  if (generation == 0 ||
+      transposition_table.size() > transposition_table.capacity() / 2) {
+    transposition_table.clear();
+  }
+  for (int i=0;i<num_squares;++i) killer_moves[i] = invalid_move;
+  last_move_depth = 0;
+  last_move_milliscore = 0;
+  return true;
+}
+
+void PlayerAB::reset() {
+  transposition_table.clear();
+  new_game();
 }
 
 Move PlayerAB::choose_move(const Position &position,
@@ -23,22 +46,25 @@ Move PlayerAB::choose_move(const Position &position,
     const Move book_move = find_book_move(position);
     if (book_move != invalid_move) {
       log_info("Book move=%s\n", move_to_string(book_move).c_str());
+      last_move_depth = 0;
       last_move_milliscore = 0;
-      moves_so_far[move_number] = book_move;
       return book_move;
     }
 
-    const Move prepared_move = find_prepared_game(move_number, moves_so_far);
+    const Move prepared_move = find_prepared_move(position);
     if (prepared_move != invalid_move) {
       log_info("Prepared move=%s\n", move_to_string(prepared_move).c_str());
+      last_move_depth = 0;
       last_move_milliscore = 0;
-      moves_so_far[move_number] = prepared_move;
       return prepared_move;
     }
   }
 
   allocate_resources(position, settings);
   nodes_visited = 0;
+  if (evaluator_type == EvaluatorType::neural) {
+    accumulators[move_number].refresh(position);
+  }
 
   // Generate root moves.
   Move moves[max_moves];
@@ -51,11 +77,11 @@ Move PlayerAB::choose_move(const Position &position,
       const Move move = first_square(remaining_moves);
       remaining_moves = reset_bit(remaining_moves, move);
       Position next_position;
-      position.make_move(move, next_position);
+      make_move(position, move, next_position);
       const Milliscore score =
         next_position.finished() ?
         -next_position.final_score() << milliscore_bits :
-        -evaluate(next_position);
+        -evaluate_position(next_position);
       move_scores[num_moves++] = {move, score};
     }
     std::sort(move_scores,
@@ -69,12 +95,13 @@ Move PlayerAB::choose_move(const Position &position,
     }
     best_milliscore = move_scores[0].second;
   }
+  int completed_depth = 1;
 
   // Single move?
   if (settings.quick_if_single_move && num_moves == 1) {
     log_info("Only one move\n");
+    last_move_depth = 0;
     last_move_milliscore = 0;
-    moves_so_far[move_number] = moves[0];
     return moves[0];
   }
 
@@ -93,7 +120,7 @@ Move PlayerAB::choose_move(const Position &position,
       // First move.
       deadline = deadline_drop_work;
       Position next_position;
-      position.make_move(moves[0], next_position);
+      make_move(position, moves[0], next_position);
 
       Milliscore score;
       Milliscore alpha = aspiration_alpha;
@@ -125,7 +152,7 @@ Move PlayerAB::choose_move(const Position &position,
 
         const Move move = moves[move_index];
         Position next_position;
-        position.make_move(move, next_position);
+        make_move(position, move, next_position);
 
         Milliscore beta = best_milliscore + 1;
         Milliscore score;
@@ -140,6 +167,7 @@ Move PlayerAB::choose_move(const Position &position,
           std::rotate(moves, moves + move_index, moves + (move_index + 1));
         }
       }
+      completed_depth = depth;
       log_verbose("  depth=%d move=%s score=%.6f time=%.3f\n",
                   depth, move_to_string(moves[0]).c_str(),
                   std::ldexp(best_milliscore, -milliscore_bits),
@@ -216,6 +244,7 @@ Move PlayerAB::choose_move(const Position &position,
           std::rotate(moves, moves + move_index, moves + (move_index + 1));
         }
       }
+      completed_depth = num_squares - move_number;
       log_verbose("  endgame score=%d time=%.3f\n",
                   static_cast<int>(best_score),
                   to_seconds(current_time() - settings.start_time));
@@ -297,17 +326,26 @@ done:
            transposition_table.out_of_memory() ? "-OOM!" : "",
            transposition_table.capacity() >> 10);
 
+  last_move_depth = completed_depth;
   last_move_milliscore = best_milliscore;
-  moves_so_far[move_number] = moves[0];
   return moves[0];
 }
 
-void PlayerAB::opponent_move(const Position &position, const Move move) {
-  moves_so_far[position.move_number()] = move;
+PlayerAB::TranspositionTableEntry *
+PlayerAB::find_transposition(const Position &position) {
+  TranspositionTableEntry *const entry = transposition_table.find(position);
+  if (entry && entry->generation != generation) {
+    *entry = TranspositionTableEntry{};
+    entry->generation = generation;
+  }
+  return entry;
 }
 
 Milliscore PlayerAB::evaluate_depth(const Position &position, int depth) {
   deadline = current_time() + std::chrono::seconds(3600);
+  if (evaluator_type == EvaluatorType::neural) {
+    accumulators[position.move_number()].refresh(position);
+  }
   if (position.move_number() + depth >= num_squares) {
     return endgame_alpha_beta(position, -max_score, max_score) << milliscore_bits;
   } else {
@@ -315,6 +353,27 @@ Milliscore PlayerAB::evaluate_depth(const Position &position, int depth) {
   }
 }
 
+void PlayerAB::ponder(const Position &position, const std::atomic<bool> &stop) {
+  if (position.finished()) return;
+  log_info("Pondering\n");
+  const int saved_depth = last_move_depth;
+  const Milliscore saved_milliscore = last_move_milliscore;
+
+  PlaySettings settings;
+  settings.start_time = current_time();
+  settings.time_left = std::chrono::hours{1};
+  settings.use_all_resources = true;
+  settings.quick_if_single_move = false;
+  settings.use_book = false;
+  stop_search = &stop;
+  choose_move(position, settings);
+  stop_search = nullptr;
+  log_info("Pondered %.3f s\n", to_seconds(current_time() - settings.start_time));
+
+  last_move_depth = saved_depth;
+  last_move_milliscore = saved_milliscore;
+}
+
 void PlayerAB::allocate_resources(const Position &position,
                                   const PlaySettings &settings) {
   if (settings.use_all_resources) {
@@ -355,6 +414,25 @@ double PlayerAB::rough_time_to_solve(const int depth) {
   return std::pow(rough_endgame_branching_factor,  depth) / expected_eps;
 }
 
+inline void PlayerAB::make_move(const Position &position,
+                                const Move move,
+                                Position &next_position) {
+  position.make_move(move, next_position);
+  if (evaluator_type == EvaluatorType::neural) {
+    const int move_number = position.move_number();
+    accumulators[move_number + 1].update(accumulators[move_number],
+                                         position, move, next_position);
+  }
+}
+
+inline Milliscore PlayerAB::evaluate_position(const Position &position) {
+  if (evaluator_type == EvaluatorType::neural) {
+    return neural_evaluate(accumulators[position.move_number()], position);
+  } else {
+    return evaluate(position);
+  }
+}
+
 Milliscore PlayerAB::alpha_beta(const Position &position,
                                 const int depth,
                                 const Milliscore alpha,
@@ -363,16 +441,19 @@ Milliscore PlayerAB::alpha_beta(const Position &position,
   ++nodes_visited;
 
   if (depth == 0) {
-    return evaluate(position);
+    return evaluate_position(position);
   }
 
-  if (current_time() >= deadline) throw Timeout{};
+  if (current_time() >= deadline ||
+      (stop_search && stop_search->load(std::memory_order_relaxed))) {
+    throw Timeout{};
+  }
 
   const int move_number = position.move_number();
 
   TranspositionTableEntry *tt_entry = nullptr;
   if (depth >= min_tt_depth) {
-    tt_entry = transposition_table.find(position);
+    tt_entry = find_transposition(position);
 
     if (tt_entry && tt_entry->depth >= depth && tt_entry->probcut_allowed <= probcut_allowed) {
       if (tt_entry->type == EntryType::exact ||
@@ -388,7 +469,9 @@ Milliscore PlayerAB::alpha_beta(const Position &position,
   if (probcut_allowed && depth >= min_probcut_depth && depth <= max_probcut_depth) {
     const ProbCutInfo &probcut_info = prob_cut_info_short[move_number][depth];
     if (probcut_info.shallow_depth != -1) {
-      const double probcut_beta_d = beta + probcut_info.offset + probcut_info.stddev * probcut_stddevs;
+      const double probcut_beta_d =
+        (beta - probcut_info.intercept + probcut_info.stddev * probcut_stddevs) /
+        probcut_info.slope;
       if (probcut_beta_d > -max_milliscore+2 && probcut_beta_d < max_milliscore-2) {
         const Milliscore probcut_beta = static_cast<Milliscore>(std::round(probcut_beta_d));
         if (alpha_beta(position, probcut_info.shallow_depth, probcut_beta-1, probcut_beta, false)
@@ -397,7 +480,9 @@ Milliscore PlayerAB::alpha_beta(const Position &position,
         }
       }
 
-      const double probcut_alpha_d = alpha + probcut_info.offset - probcut_info.stddev * probcut_stddevs;
+      const double probcut_alpha_d =
+        (alpha - probcut_info.intercept - probcut_info.stddev * probcut_stddevs) /
+        probcut_info.slope;
       if (probcut_alpha_d > -max_milliscore+2 && probcut_alpha_d < max_milliscore-2) {
         const Milliscore probcut_alpha = static_cast<Milliscore>(std::round(probcut_alpha_d));
         if (alpha_beta(position, probcut_info.shallow_depth, probcut_alpha, probcut_alpha+1, false)
@@ -426,7 +511,7 @@ Milliscore PlayerAB::alpha_beta(const Position &position,
     }
     remaining_moves = reset_bit(remaining_moves, move);
     Position next_position;
-    position.make_move(move, next_position);
+    make_move(position, move, next_position);
 
     const Milliscore to_beat = std::max(alpha, best_score);
     const Milliscore limit = depth >= min_pv_depth ? to_beat + 1 : beta;
@@ -453,6 +538,7 @@ Milliscore PlayerAB::alpha_beta(const Position &position,
       tt_entry = transposition_table.insert(position, inserted);
     }
     if (tt_entry) {
+      tt_entry->generation = generation;
       if (depth >= tt_entry->depth) {
         tt_entry->depth = depth;
         tt_entry->probcut_allowed = probcut_allowed;
@@ -470,8 +556,8 @@ Milliscore PlayerAB::alpha_beta(const Position &position,
 }
 
 Score PlayerAB::endgame_alpha_beta(const Position &position,
-                                   const Score alpha,
-                                   const Score beta) {
+                                   Score alpha,
+                                   Score beta) {
   ++nodes_visited;
 
   const int move_number = position.move_number();
@@ -484,11 +570,29 @@ Score PlayerAB::endgame_alpha_beta(const Position &position,
     return endgame_0(position);
   }
 
-  if (current_time() >= deadline) throw Timeout{};
+  if (current_time() >= deadline ||
+      (stop_search && stop_search->load(std::memory_order_relaxed))) {
+    throw Timeout{};
+  }
+
+  const bool use_cache =
+    endgame_cache &&
+    depth >= endgame_min_cache_depth &&
+    depth <= endgame_max_cache_depth;
+  if (use_cache) {
+    Score lower, upper;
+    if (endgame_cache->find(position, lower, upper)) {
+      if (lower >= beta) return lower;
+      if (upper <= alpha) return upper;
+      if (lower == upper) return lower;
+      alpha = std::max(alpha, lower);
+      beta = std::min(beta, upper);
+    }
+  }
 
   TranspositionTableEntry *tt_entry = nullptr;
   if (depth >= endgame_min_tt_depth) {
-    tt_entry = transposition_table.find(position);
+    tt_entry = find_transposition(position);
 
     if (tt_entry && tt_entry->depth >= depth) {
       if (tt_entry->type == EntryType::exact ||
@@ -545,6 +649,7 @@ Score PlayerAB::endgame_alpha_beta(const Position &position,
       tt_entry = transposition_table.insert(position, inserted);
     }
     if (tt_entry) {
+      tt_entry->generation = generation;
       if (depth >= tt_entry->depth) {
         tt_entry->depth = depth;
         tt_entry->probcut_allowed = false;
@@ -558,6 +663,10 @@ Score PlayerAB::endgame_alpha_beta(const Position &position,
     }
   }
 
+  if (use_cache) {
+    endgame_cache->store(position, best_score, alpha, beta);
+  }
+
   return best_score;
 }
 
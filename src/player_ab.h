@@ -1,28 +1,59 @@
 #ifndef PLAYER_AB_H
 #define PLAYER_AB_H
 
+#include "endgame_cache.h"
 #include "evaluator.h"
 #include "hashing.h"
+#include "neural_evaluator.h"
 #include "player.h"
+#include <atomic>
 
 class PlayerAB : public Player {
 public:
-  PlayerAB();
+  enum class EvaluatorType : std::int8_t {
+    pattern,
+    neural
+  };
+
+  explicit PlayerAB(EvaluatorType _evaluator_type = EvaluatorType::pattern,
+                    std::size_t _transposition_table_buckets =
+                      default_transposition_table_buckets);
+
+  static constexpr std::size_t default_transposition_table_buckets = 1<<22;
 
   Move choose_move(const Position &position,
                    const PlaySettings &settings) override;
 
-  void opponent_move(const Position &position, Move move) override;
+  bool new_game() override;
+
+  // Like a new player: also forgets the transposition table, so that
+  // evaluate_depth doesn't pick up deeper results from earlier searches.
+  // Takes time proportional to the transposition table size.
+  void reset();
 
-  Milliscore get_last_move_milliscore() const {
+  // Depth of the last completed iteration. Number of empty squares if the
+  // endgame was solved.
+  int get_last_move_depth() const override {
+    return last_move_depth;
+  }
+
+  Milliscore get_last_move_milliscore() const override {
     return last_move_milliscore;
   }
 
   Milliscore evaluate_depth(const Position &position, int depth);
 
-private:
-  static constexpr std::size_t transposition_table_buckets = 1<<22;
+  // Searches position, with the opponent to move, until stop is set by
+  // another thread. This covers every reply: the next choose_move finds
+  // the results in the transposition table and killer moves.
+  void ponder(const Position &position, const std::atomic<bool> &stop);
 
+  // Optional, not owned. May be shared with other players and threads.
+  void set_endgame_cache(EndgameCache *const cache) {
+    endgame_cache = cache;
+  }
+
+private:
   static constexpr int allocation_move0  = 1000;
   static constexpr int allocation_move50 = 4000;
   static constexpr int endgame_solve_allocation = 4000; // tweak
@@ -48,6 +79,8 @@ private:
   static constexpr int max_eval_move_number = 58;
   static constexpr int min_tt_depth = 2;
   static constexpr int endgame_min_tt_depth = 4;
+  static constexpr int endgame_min_cache_depth = 4;
+  static constexpr int endgame_max_cache_depth = 6;
   // In units of score / 1024:
   static constexpr Milliscore aspiration_width = 200 << (milliscore_bits - 10);
   static constexpr Score endgame_aspiration_width = 1;
@@ -76,6 +109,8 @@ private:
     EntryType type=EntryType::exact;
     Move move=invalid_move;
     bool probcut_allowed=false;
+    // Of the game the entry was stored in.
+    std::uint8_t generation=0;
   };
   static_assert(PositionHashTable<TranspositionTableEntry>::sizeof_entry == 32,
                 "");
@@ -84,6 +119,13 @@ private:
                           const PlaySettings &settings);
   double rough_time_to_solve(const int depth);
 
+  // Also updates the neural accumulator for next_position, if used.
+  void make_move(const Position &position, Move move, Position &next_position);
+  Milliscore evaluate_position(const Position &position);
+
+  // Entries stored in earlier games come back empty.
+  TranspositionTableEntry *find_transposition(const Position &position);
+
   Milliscore alpha_beta(const Position &position, const int depth,
                         const Milliscore alpha, const Milliscore beta,
                         bool probcut_allowed);
@@ -106,16 +148,23 @@ private:
   Move choose_move_statically(const Position &position,
                               Bitboard move_options);
 
+  EvaluatorType evaluator_type;
+  // [move number]
+  NeuralAccumulator accumulators[num_squares+1];
+
   PositionHashTable<TranspositionTableEntry> transposition_table;
+  std::uint8_t generation = 0;
+  EndgameCache *endgame_cache = nullptr;
   Move killer_moves[num_squares];
   Timestamp deadline;
+  // Set while pondering.
+  const std::atomic<bool> *stop_search = nullptr;
   Timestamp deadline_go_deeper;
   Timestamp deadline_next_move;
   Timestamp deadline_drop_work;
   std::int64_t nodes_visited;
+  int last_move_depth = 0;
   Milliscore last_move_milliscore = 0;
-
-  Move moves_so_far[num_squares];
 };
 
 #endif
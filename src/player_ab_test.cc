@@ -0,0 +1,74 @@
+#include "clock.h"
+#include "player_ab.h"
+#include "player_mcts.h"
+#include "tests.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+TEST(test_shared_endgame_cache) {
+  constexpr int empty = 12;
+  RandomGenerator rng;
+  PlayerAB plain{PlayerAB::EvaluatorType::pattern, 1<<16};
+  PlayerAB cached{PlayerAB::EvaluatorType::pattern, 1<<16};
+  PlayerMcts mcts{1, std::size_t{1} << 22};
+  cached.set_endgame_cache(&mcts.get_endgame_cache());
+
+  for (int game = 0; game < 20; ++game) {
+    Position position = Position::initial();
+    while (position.move_number() < num_squares - empty) {
+      position.make_move(rng.get_square(position.valid_moves()), position);
+    }
+
+    // The mcts player fills the cache with its solves near the end of the
+    // tree.
+    PlaySettings settings;
+    settings.start_time = current_time();
+    settings.time_left = std::chrono::milliseconds{200};
+    settings.use_book = false;
+    mcts.new_game();
+    mcts.choose_move(position, settings);
+
+    plain.reset();
+    const Milliscore expected = plain.evaluate_depth(position, empty);
+    // Twice: the second solve starts from an empty transposition table and
+    // takes its bounds from what the first one stored in the cache.
+    for (int i = 0; i < 2; ++i) {
+      cached.reset();
+      assert(cached.evaluate_depth(position, empty) == expected);
+    }
+  }
+}
+
+TEST(test_ponder_stops) {
+  PlayerAB player{PlayerAB::EvaluatorType::pattern, 1<<16};
+  Position position = Position::initial();
+  for (int i = 0; i < 4; ++i) {
+    position.make_move(first_square(position.valid_moves()), position);
+  }
+  PlaySettings settings;
+  settings.start_time = current_time();
+  settings.time_left = std::chrono::milliseconds{500};
+  settings.use_book = false;
+  const Move move = player.choose_move(position, settings);
+  const int depth = player.get_last_move_depth();
+  const Milliscore milliscore = player.get_last_move_milliscore();
+  assert(depth > 0);
+  position.make_move(move, position);
+
+  // Without the stop flag, pondering would go on for an hour.
+  std::atomic<bool> stop{false};
+  Timestamp stop_time;
+  std::thread stopper([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    stop_time = current_time();
+    stop = true;
+  });
+  player.ponder(position, stop);
+  const Timestamp return_time = current_time();
+  stopper.join();
+  assert(return_time - stop_time < std::chrono::milliseconds{20});
+
+  assert(player.get_last_move_depth() == depth);
+  assert(player.get_last_move_milliscore() == milliscore);
+}
@@ -17,6 +17,9 @@ public:
 
   void opponent_move(const Position &, Move move) override;
 
+  // The child process only plays one game.
+  bool new_game() override { return false; }
+
 private:
   void check_error(int ret);
 
@@ -1,18 +1,38 @@
+#include "book.h"
 #include "clock.h"
 #include "evaluator.h"
 #include "hashing.h"
 #include "logging.h"
 #include "player_ab.h"
+#include "prepared.h"
+#include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <thread>
 
 constexpr Duration default_game_time{std::chrono::milliseconds(4850)};
 
-int main() {
+int main(int argc, char **argv) {
 #ifdef SUBMISSION
   verbosity = 1;
 #endif
 
+  // -book <file>: use a book file instead of the compiled-in book.
+  // -ponder: search on the opponent's time. Needs a core of its own.
+  std::string book_file_name;
+  bool use_pondering = false;
+  for (int next = 1; next < argc; ++next) {
+    const std::string arg{argv[next]};
+    if (arg == "-book" && next + 1 < argc) {
+      book_file_name = argv[++next];
+    } else if (arg == "-ponder") {
+      use_pondering = true;
+    } else {
+      log_always("Invalid argument: %s\n", arg.c_str());
+      std::exit(1);
+    }
+  }
+
   std::string input;
   getline(std::cin, input);
 
@@ -38,7 +58,14 @@ int main() {
 
   init_hashing();
   init_evaluator();
+  init_book();
+  init_prepared();
+  if (!book_file_name.empty() && !load_book_file(book_file_name)) {
+    log_always("Using the compiled-in book\n");
+  }
   PlayerAB player;
+  std::atomic<bool> stop_pondering{false};
+  std::thread pondering_thread;
 
   {
     const Timestamp t = current_time();
@@ -80,12 +107,25 @@ int main() {
       log_info("time left %.3f\n", to_seconds(time_left));
       std::cout << move_to_string(my_move) << '\n';
       std::cout.flush();
+
+      if (use_pondering && !position.finished()) {
+        stop_pondering = false;
+        pondering_thread = std::thread{[&player, &stop_pondering, position] {
+          player.ponder(position, stop_pondering);
+        }};
+      }
     }
 
 next_input:
     std::fflush(stderr);
     getline(std::cin, input);
     start_time = current_time();
+    if (pondering_thread.joinable()) {
+      stop_pondering = true;
+      pondering_thread.join();
+      log_info("Stopped pondering in %.3f ms\n",
+               1e3 * to_seconds(current_time() - start_time));
+    }
     if (!std::cin) std::exit(EXIT_SUCCESS);
   }
 }
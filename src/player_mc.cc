@@ -1,4 +1,5 @@
 #include "player_mc.h"
+#include "batch_rollout.h"
 #include "logging.h"
 #include <algorithm>
 
@@ -27,7 +28,7 @@ Move PlayerMc::choose_move(const Position &position,
       position.make_move(move_option.move, pos2);
 
       move_option.total_score -= simulate(pos2);
-      ++num_simulations;
+      num_simulations += rollout_batch_size;
     }
     ++num_rounds;
   }
@@ -41,7 +42,8 @@ Move PlayerMc::choose_move(const Position &position,
   log_info("Best moves:");
   for (std::size_t i=0; i < move_options.size() && i < 3; ++i) {
     log_info(" %s (%.3f)", move_to_string(move_options[i].move).c_str(),
-             static_cast<double>(move_options[i].total_score) / num_rounds);
+             static_cast<double>(move_options[i].total_score) /
+             (num_rounds * rollout_batch_size));
   }
   log_info("\n");
 
@@ -49,13 +51,11 @@ Move PlayerMc::choose_move(const Position &position,
 }
 
 int PlayerMc::simulate(const Position &position) {
-  Position pos2 = position;
-  int rounds = 0;
-  while (!pos2.finished()) {
-    const Move move = random_generator.get_square(pos2.valid_moves());
-    pos2.make_move(move, pos2);
-    ++rounds;
-  }
-  const int score = pos2.final_score();
-  return (rounds & 1) ? -score : score;
+  Position positions[rollout_batch_size];
+  std::fill(positions, positions + rollout_batch_size, position);
+  Score scores[rollout_batch_size];
+  batch_random_rollouts(positions, false, random_generator, scores);
+  int total = 0;
+  for (const Score score : scores) total += score;
+  return total;
 }
@@ -16,6 +16,7 @@ private:
     std::int64_t total_score = 0;
   };
 
+  // Sum of scores of rollout_batch_size random games.
   int simulate(const Position &position);
 
   RandomGenerator random_generator;
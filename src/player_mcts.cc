@@ -1,36 +1,64 @@
 #include "player_mcts.h"
+#include "batch_rollout.h"
 #include "mathematics.h"
 #include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <cstring>
+#include <functional>
 #include <memory>
-
-PlayerMcts::PlayerMcts() :
-    allocator{pool_allocator_size},
-    mcts_node_lookup{mcts_node_lookup_buckets},
+#include <mutex>
+#include <thread>
+#include <emmintrin.h>
+
+PlayerMcts::PlayerMcts(const int _num_threads,
+                       const std::size_t _semispace_size) :
+    num_threads{_num_threads},
+    random_generators(_num_threads),
+    semispaces{PoolAllocator{_semispace_size}, PoolAllocator{_semispace_size}},
+    allocator{&semispaces[0]},
+    mcts_node_lookup{mcts_node_lookup_buckets(_semispace_size)},
+    endgame_cache{endgame_cache_entries},
     root_exploration_factor_table(precompute_tables_size),
-    exploration_factor_table(precompute_tables_size),
-    child_uncertainty_table(precompute_tables_size) {
+    exploration_factor_table(precompute_tables_size) {
+  // Every thread adds at most one virtual loss to a child, and they're
+  // counted in int8.
+  assert(num_threads >= 1 && num_threads < 128);
   log_info("Precompute tables allocated %.2f MB\n",
-           static_cast<double>(3 * precompute_tables_size * sizeof(double))/
+           static_cast<double>(2 * precompute_tables_size * sizeof(double))/
            (1 << 20));
   for (long i=0; i<precompute_tables_size; ++i) {
     root_exploration_factor_table[i] = raw_root_exploration_factor(i);
     exploration_factor_table[i] = raw_exploration_factor(i);
-    child_uncertainty_table[i] = raw_child_uncertainty(i);
   }
 }
 
+std::size_t PlayerMcts::mcts_node_lookup_buckets(const std::size_t semispace_size) {
+  const std::size_t nodes = semispace_size / (sizeof(MctsNode) + sizeof(ChildGroup));
+  std::size_t buckets = 16;
+  while (buckets / 16 * 15 < nodes) buckets *= 2;
+  return buckets;
+}
+
+bool PlayerMcts::new_game() {
+  // reroot won't find the last position and starts from an empty semispace,
+  // whose pages stay mapped.
+  mcts_node_lookup.clear();
+  root = nullptr;
+  return true;
+}
+
 Move PlayerMcts::choose_move(const Position &position,
                              const PlaySettings &settings) {
   allocate_resources(position, settings);
-  const std::size_t initial_allocator_used = allocator.used();
+  reroot(position);
+  const std::size_t initial_allocator_used = allocator->used();
   const std::size_t initial_mcts_node_lookup_size = mcts_node_lookup.size();
 
   root = find_or_allocate_node(position);
   if (!root) {
     log_info("Could not allocate root! Making random move.\n");
-    return random_generator.get_square(position.valid_moves());
+    return random_generators[0].get_square(position.valid_moves());
   }
 
   if (settings.quick_if_single_move && root->num_children == 1) {
@@ -43,9 +71,13 @@ Move PlayerMcts::choose_move(const Position &position,
   const Move final_choice = final_move_select();
 
   log_info("RAM: %.2f / %.2f MB\n",
-           static_cast<double>(allocator.used() - initial_allocator_used) / (1<<20),
-           static_cast<double>(allocator.limit() - initial_allocator_used) / (1<<20));
-  if (allocator.out_of_memory()) {
+           static_cast<double>(allocator->used() - initial_allocator_used) / (1<<20),
+           static_cast<double>(allocator->limit() - initial_allocator_used) / (1<<20));
+  log_info("Allocations: %zu, %.2f MB requested, %.2f MB padding\n",
+           allocator->num_allocations(),
+           static_cast<double>(allocator->bytes_requested()) / (1<<20),
+           static_cast<double>(allocator->padding()) / (1<<20));
+  if (allocator->out_of_memory()) {
     log_info("OOM: allocator!!!!!!!!!!\n");
   }
   log_info("Nodes: %zu / %zu\n",
@@ -80,15 +112,70 @@ void PlayerMcts::allocate_resources(const Position &position,
   }
 
   deadline = settings.start_time + settings.time_left * numerator / denominator;
+}
 
-  allocator.set_limit(
-      allocator.used() + (allocator.capacity() - allocator.used()) * numerator / denominator);
+void PlayerMcts::reroot(const Position &position) {
+  const CompressedPtr<MctsNode> *const old_root_ptr = mcts_node_lookup.find(position);
+  const MctsNode *const old_root =
+    old_root_ptr ? allocator->decompress(*old_root_ptr) : nullptr;
+
+  const PoolAllocator &old_allocator = *allocator;
+  allocator = &semispaces[allocator == &semispaces[0] ? 1 : 0];
+  allocator->clear();
+  allocator->set_limit(allocator->capacity());
+  mcts_node_lookup.clear();
+  mcts_node_lookup.set_limit(mcts_node_lookup.capacity());
+
+  // Everything live was in the old semispace, so copying can't run out of
+  // memory.
+  if (old_root) {
+    copy_subtree(old_allocator, *old_root);
+  }
+  log_info("Reused %zu nodes, %.2f MB\n",
+           mcts_node_lookup.size(),
+           static_cast<double>(allocator->used()) / (1<<20));
+}
+
+PlayerMcts::MctsNode *PlayerMcts::copy_subtree(const PoolAllocator &old_allocator,
+                                               const MctsNode &old_node) {
+  bool inserted;
+  CompressedPtr<MctsNode> *const node_ptr_ptr =
+    mcts_node_lookup.insert(old_node.position, inserted);
+  assert(node_ptr_ptr);
+  if (!inserted) {
+    // Transposition, already copied.
+    return allocator->decompress(*node_ptr_ptr);
+  }
 
-  mcts_node_lookup.set_limit(
-      mcts_node_lookup.size() + (mcts_node_lookup.capacity() - mcts_node_lookup.size()) * numerator / denominator);
+  MctsNode *const node = allocator->construct<MctsNode>(old_node);
+  assert(node);
+  *node_ptr_ptr = allocator->compress(node);
+
+  node->children_capacity = round_up_to_groups(node->visited_children);
+  node->children = CompressedPtr<ChildGroup>{};
+  if (node->visited_children == 0) return node;
+
+  const int num_groups = node->children_capacity / child_group_size;
+  ChildGroup *const children = allocator->allocate<ChildGroup>(num_groups);
+  assert(children);
+  node->children = allocator->compress(children);
+
+  const ChildGroup *const old_children = old_allocator.decompress(old_node.children);
+  std::uninitialized_copy(old_children, old_children + num_groups, children);
+  for (int i = 0; i < node->visited_children; ++i) {
+    ChildGroup &group = children[i / child_group_size];
+    const int lane = i % child_group_size;
+    if (!group.full_node[lane].is_null()) {
+      MctsNode *const child_node =
+        copy_subtree(old_allocator, *old_allocator.decompress(group.full_node[lane]));
+      group.full_node[lane] = allocator->compress(child_node);
+    }
+  }
+  return node;
 }
 
 PlayerMcts::MctsNode *PlayerMcts::find_or_allocate_node(const Position &position) {
+  std::lock_guard<SpinLock> guard(mcts_node_lookup_lock);
   bool inserted;
   CompressedPtr<MctsNode> *const node_ptr_ptr = mcts_node_lookup.insert(position, inserted);
   if (!node_ptr_ptr) {
@@ -98,49 +185,92 @@ PlayerMcts::MctsNode *PlayerMcts::find_or_allocate_node(const Position &position
   if ((*node_ptr_ptr).is_null()) {
     // New node, or allocation previously failed.
     // The following may fail and return nullptr.
-    MctsNode *const node = allocator.construct<MctsNode>(position);
-    *node_ptr_ptr = allocator.compress(node);
+    MctsNode *const node = allocator->construct<MctsNode>(position);
+    *node_ptr_ptr = allocator->compress(node);
     return node;
   } else {
-    return allocator.decompress(*node_ptr_ptr);
+    return allocator->decompress(*node_ptr_ptr);
   }
 }
 
 void PlayerMcts::explore_root() {
-  std::int64_t num_simulations = 0;
-  while (root->score_lower < root->score_upper && current_time() < deadline) {
-    explore(*root, -max_score, max_score);
-    ++num_simulations;
+  const Timestamp start_time = current_time();
+  std::vector<std::int64_t> num_simulations(num_threads, 0);
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; ++i) {
+    threads.emplace_back(&PlayerMcts::explore_thread, this,
+                         std::ref(random_generators[i]),
+                         std::ref(num_simulations[i]));
+  }
+  explore_thread(random_generators[0], num_simulations[0]);
+  for (std::thread &thread : threads) {
+    thread.join();
   }
-  log_info("Simulations %" PRId64 "\n", num_simulations);
+
+  std::int64_t total_simulations = 0;
+  for (const std::int64_t n : num_simulations) total_simulations += n;
+  const double seconds = to_seconds(current_time() - start_time);
+  log_info("Simulations %" PRId64 " (%.0f / s)\n",
+           total_simulations,
+           seconds > 0.0 ? total_simulations / seconds : 0.0);
 }
 
-void PlayerMcts::explore(MctsNode &node, Score alpha, const Score beta) {
-  alpha = std::max(alpha, node.score_lower);
-  if (node.score_lower >= beta ||
-      node.score_upper <= alpha) {
-    return;
+void PlayerMcts::explore_thread(RandomGenerator &rng,
+                                std::int64_t &num_simulations) {
+  for (;;) {
+    {
+      std::lock_guard<SpinLock> guard(root->lock);
+      if (root->score_lower >= root->score_upper) break;
+    }
+    if (current_time() >= deadline) break;
+    explore(*root, -max_score, max_score, rng);
+    ++num_simulations;
   }
+}
+
+void PlayerMcts::explore(MctsNode &node, Score alpha, const Score beta,
+                         RandomGenerator &rng) {
+  // Select a child. Locks are never held while going deeper.
+  int child_idx;
+  Move move;
+  std::int64_t child_games;
+  CompressedPtr<MctsNode> child_full_node;
+  {
+    std::lock_guard<SpinLock> guard(node.lock);
+    alpha = std::max(alpha, node.score_lower);
+    if (node.score_lower >= beta ||
+        node.score_upper <= alpha) {
+      return;
+    }
 
-  MiniMctsNode *const child = tree_move_select(node, alpha);
+    child_idx = tree_move_select(node, alpha, rng);
+    ChildGroup &group = allocator->decompress(node.children)[child_idx / child_group_size];
+    const int lane = child_idx % child_group_size;
+    ++group.virtual_losses[lane];
+    move = group.move[lane];
+    child_games = group.num_games[lane];
+    child_full_node = group.full_node[lane];
+  }
 
   Position next_position;
 
   int played = 0; // 1 = additional game, 2 = full score
   int64_t play_milliscore = 0;
+  Score child_score_lower = -max_score;
+  Score child_score_upper = max_score;
 
   MctsNode *child_node = nullptr;
-  if (child->full_node.is_null()) {
-    node.position.make_move(child->move, next_position);
+  if (child_full_node.is_null()) {
+    node.position.make_move(move, next_position);
 
-    if (child->num_games >= min_games_to_expand) {
+    if (child_games >= min_games_to_expand) {
       if (next_position.move_number() >= alpha_beta_move_number) {
-        const Score score = -alpha_beta(next_position, -beta, -alpha);
+        const Score score = -cached_alpha_beta(next_position, -beta, -alpha);
         if (score > alpha) {
-          child->score_lower = std::max(child->score_lower, score);
+          child_score_lower = score;
         }
         if (score < beta) {
-          child->score_upper = std::min(child->score_upper, score);
+          child_score_upper = score;
         }
         played = 2;
         play_milliscore = int64_t{score} << milliscore_bits;
@@ -148,89 +278,129 @@ void PlayerMcts::explore(MctsNode &node, Score alpha, const Score beta) {
         // Expand child.
         child_node = find_or_allocate_node(next_position);
         if (child_node) {
-          child->full_node = allocator.compress(child_node);
-          // Add simulations we already have.
-          const std::int64_t prev_games = child_node->num_games;
-
-          child_node->num_games += child->num_games;
-          child_node->total_milliscore -= child->total_milliscore;
-
-          if (prev_games < evaluate_after_visits &&
-              child_node->num_games >= evaluate_after_visits) {
-            evaluate_node(*child_node);
+          std::lock_guard<SpinLock> guard(node.lock);
+          ChildGroup &group =
+            allocator->decompress(node.children)[child_idx / child_group_size];
+          const int lane = child_idx % child_group_size;
+          // Another thread may have expanded it in the meantime.
+          if (group.full_node[lane].is_null()) {
+            group.full_node[lane] = allocator->compress(child_node);
+            // Add simulations we already have.
+            // Lock order: parent before child.
+            std::lock_guard<SpinLock> child_guard(child_node->lock);
+            const std::int64_t prev_games = child_node->num_games;
+
+            child_node->num_games += group.num_games[lane];
+            child_node->total_milliscore -= total_milliscore(group, lane);
+
+            if (prev_games < evaluate_after_visits &&
+                child_node->num_games >= evaluate_after_visits) {
+              evaluate_node(*child_node);
+            }
           }
         }
       }
     }
   } else {
-    child_node = allocator.decompress(child->full_node);
+    child_node = allocator->decompress(child_full_node);
   }
 
   if (child_node) {
     // Explore recursively.
-    explore(*child_node, -beta, -alpha);
+    explore(*child_node, -beta, -alpha, rng);
     // Update info.
-    child->score_lower = -child_node->score_upper;
-    child->score_upper = -child_node->score_lower;
+    std::lock_guard<SpinLock> child_guard(child_node->lock);
+    child_score_lower = -child_node->score_upper;
+    child_score_upper = -child_node->score_lower;
     played = 2;
     play_milliscore =
       -rounding_divide(child_node->total_milliscore, child_node->num_games);
     play_milliscore = std::max(
         play_milliscore,
-        std::int64_t{child->score_lower} << milliscore_bits);
+        std::int64_t{child_score_lower} << milliscore_bits);
     play_milliscore = std::min(
         play_milliscore,
-        std::int64_t{child->score_upper} << milliscore_bits);
+        std::int64_t{child_score_upper} << milliscore_bits);
   }
 
-  if (played) {
-    node.score_lower = std::max(node.score_lower, child->score_lower);
-    if (child->score_upper < node.score_upper &&
+  if (!played) {
+    played = 1;
+    play_milliscore = -random_rollout(next_position, rng);
+  }
+
+  std::lock_guard<SpinLock> guard(node.lock);
+  ChildGroup *const children = allocator->decompress(node.children);
+  ChildGroup &group = children[child_idx / child_group_size];
+  const int lane = child_idx % child_group_size;
+  --group.virtual_losses[lane];
+
+  if (played == 2) {
+    group.score_lower[lane] = std::max(group.score_lower[lane], child_score_lower);
+    group.score_upper[lane] = std::min(group.score_upper[lane], child_score_upper);
+    node.score_lower = std::max(node.score_lower, group.score_lower[lane]);
+    if (group.score_upper[lane] < node.score_upper &&
         node.visited_children == node.num_children) {
       node.score_upper = -max_score;
-      const MiniMctsNode *const children = allocator.decompress(node.children);
       for (int ch = 0; ch < node.num_children; ++ch) {
-        node.score_upper = std::max(node.score_upper, children[ch].score_upper);
+        node.score_upper = std::max(
+            node.score_upper,
+            children[ch / child_group_size].score_upper[ch % child_group_size]);
       }
     }
-  } else {
-    played = 1;
-    play_milliscore = -(random_rollout(next_position) << milliscore_bits);
   }
 
-  node.total_milliscore -= child->total_milliscore;
+  node.total_milliscore -= total_milliscore(group, lane);
   // Only increase child count by 1 to avoid skewing statistics for shared children.
-  ++child->num_games;
+  const std::int32_t child_games_after = ++group.num_games[lane];
 
+  const float play_score = std::ldexp(static_cast<float>(play_milliscore), -milliscore_bits);
   if (played == 2) {
-    child->total_milliscore = child->num_games * play_milliscore;
+    group.average_score[lane] = play_score;
   } else {
-    child->total_milliscore += play_milliscore;
+    group.average_score[lane] +=
+      (play_score - group.average_score[lane]) / child_games_after;
   }
 
   ++node.num_games;
-  node.total_milliscore += child->total_milliscore;
+  node.total_milliscore += total_milliscore(group, lane);
 
   if (node.num_games == evaluate_after_visits) {
     evaluate_node(node);
   }
 }
 
-Score PlayerMcts::random_rollout(const Position &position) {
-  Position pos2 = position;
-  while (!pos2.finished()) {
-    const Bitboard valid_moves = pos2.valid_moves();
-    const Move move = rollout_move_select(position, valid_moves);
-    pos2.make_move(move, pos2);
+Milliscore PlayerMcts::random_rollout(const Position &position,
+                                      RandomGenerator &rng) {
+  Position positions[rollout_batch_size];
+  std::fill(positions, positions + rollout_batch_size, position);
+  Score scores[rollout_batch_size];
+  batch_random_rollouts(positions, true, rng, scores);
+  Milliscore total = 0;
+  for (const Score score : scores) {
+    total += Milliscore{score} << milliscore_bits;
+  }
+  return total / rollout_batch_size;
+}
+
+Score PlayerMcts::cached_alpha_beta(const Position &position,
+                                    Score alpha,
+                                    Score beta) {
+  Score lower, upper;
+  if (endgame_cache.find(position, lower, upper)) {
+    if (lower >= beta) return lower;
+    if (upper <= alpha) return upper;
+    if (lower == upper) return lower;
+    alpha = std::max(alpha, lower);
+    beta = std::min(beta, upper);
   }
-  const Score score = pos2.final_score();
-  return position.to_move() == 0 ? score : -score;
+  const Score score = alpha_beta(position, alpha, beta);
+  endgame_cache.store(position, score, alpha, beta);
+  return score;
 }
 
 Score PlayerMcts::alpha_beta(const Position &position,
                              const Score alpha,
                              const Score beta) {
-  // TODO: Memoize?
   if (position.finished()) {
     return position.final_score();
   }
@@ -250,121 +420,195 @@ Score PlayerMcts::alpha_beta(const Position &position,
   return best_score;
 }
 
-PlayerMcts::MiniMctsNode *PlayerMcts::tree_move_select(MctsNode &node,
-                                                       const Score alpha) {
-  MiniMctsNode *children = allocator.decompress(node.children);
+int PlayerMcts::tree_move_select(MctsNode &node,
+                                 const Score alpha,
+                                 RandomGenerator &rng) {
+  ChildGroup *children = allocator->decompress(node.children);
 
   if (node.visited_children < node.num_children) {
     if (node.visited_children == node.children_capacity) {
       // Resize children.
       const int new_capacity =
-        std::min<int>(2 * node.children_capacity + 1, node.num_children);
-      MiniMctsNode *const new_children = allocator.allocate<MiniMctsNode>(new_capacity);
+        std::min<int>(2 * node.children_capacity + child_group_size,
+                      round_up_to_groups(node.num_children));
+      const int old_groups = node.children_capacity / child_group_size;
+      const int new_groups = new_capacity / child_group_size;
+      ChildGroup *const new_children = allocator->allocate<ChildGroup>(new_groups);
       if (!new_children) {
         // OOM!
         goto failed_oom;
       }
-      for (int i=0; i<node.visited_children; ++i) {
-        new (new_children+i) MiniMctsNode(std::move(children[i]));
+      std::uninitialized_copy(children, children + old_groups, new_children);
+      // Unused lanes take part in vector computations, so they must not be
+      // garbage.
+      for (int g = old_groups; g < new_groups; ++g) {
+        new (new_children + g) ChildGroup{};
       }
       node.children_capacity = new_capacity;
       children = new_children;
-      node.children = allocator.compress(children);
+      node.children = allocator->compress(children);
     }
     // Pick an unexplored child and add.
-    const Move move = rollout_move_select(node.position, node.unvisited_moves);
+    const Move move = rollout_move_select(node.position, node.unvisited_moves, rng);
 
-    MiniMctsNode *const child = children + node.visited_children;
-    new (child) MiniMctsNode(move);
+    const int child_idx = node.visited_children;
+    init_child(children[child_idx / child_group_size],
+               child_idx % child_group_size,
+               move);
 
     node.unvisited_moves = reset_bit(node.unvisited_moves, move);
     ++node.visited_children;
 
-    return child;
+    return child_idx;
   }
 
 failed_oom:
 
-  MiniMctsNode *child = nullptr;
-  double best_bound = -1e100;
-
   const double E =
     &node == root ?
     root_exploration_factor(node.num_games) :
     exploration_factor(node.num_games);
 
-  for (int child_idx=0; child_idx != node.visited_children; ++child_idx) {
-    MiniMctsNode *const p = children + child_idx;
-    if (p->score_upper <= alpha) {
-      // This move can't help.
-      continue;
-    }
-    const double bound = p->average_score() + E * child_uncertainty(p->num_games);
-    if (bound > best_bound) {
-      child = p;
-      best_bound = bound;
-    }
+  return best_bound_child(children, node.visited_children, alpha,
+                          static_cast<float>(E));
+}
+
+namespace {
+  // Sign extend 4 bytes to 4 int32 lanes.
+  inline __m128i widen_int8(const std::int8_t (&x)[4]) {
+    std::int32_t packed;
+    std::memcpy(&packed, x, sizeof(packed));
+    __m128i v = _mm_cvtsi32_si128(packed);
+    v = _mm_unpacklo_epi8(v, v);
+    v = _mm_unpacklo_epi16(v, v);
+    return _mm_srai_epi32(v, 24);
+  }
+}
+
+int PlayerMcts::best_bound_child(const ChildGroup *const children,
+                                 const int num_children,
+                                 const Score alpha,
+                                 const float exploration) {
+  static_assert(child_group_size == 4, "one SSE vector per group");
+  const int num_groups = round_up_to_groups(num_children) / child_group_size;
+
+  alignas(16) float bounds[round_up_to_groups(max_moves)];
+
+  const __m128 exploration_v = _mm_set1_ps(exploration);
+  const __m128 virtual_loss_v = _mm_set1_ps(static_cast<float>(virtual_loss_score));
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 minus_infinity = _mm_set1_ps(-HUGE_VALF);
+  const __m128 infinity = _mm_set1_ps(HUGE_VALF);
+  const __m128 zero = _mm_setzero_ps();
+  const __m128i alpha_v = _mm_set1_epi32(alpha);
+  const __m128i lane_index = _mm_setr_epi32(0, 1, 2, 3);
+
+  __m128 best = minus_infinity;
+  for (int g = 0; g < num_groups; ++g) {
+    const ChildGroup &group = children[g];
+    const __m128 games =
+      _mm_cvtepi32_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(group.num_games)));
+    const __m128 losses = _mm_cvtepi32_ps(widen_int8(group.virtual_losses));
+    const __m128 visits = _mm_add_ps(games, losses);
+    // Running simulations count as losses.
+    const __m128 total = _mm_sub_ps(_mm_mul_ps(_mm_load_ps(group.average_score), games),
+                                    _mm_mul_ps(losses, virtual_loss_v));
+    const __m128 uncertainty = _mm_div_ps(one, _mm_sqrt_ps(visits));
+    const __m128 visited_bound = _mm_add_ps(_mm_div_ps(total, visits),
+                                            _mm_mul_ps(exploration_v, uncertainty));
+    // 0 / 0 would be NaN.
+    const __m128 unvisited = _mm_cmpeq_ps(visits, zero);
+    const __m128 bound = _mm_or_ps(_mm_and_ps(unvisited, infinity),
+                                   _mm_andnot_ps(unvisited, visited_bound));
+
+    // Skip unused lanes, and moves that can't help.
+    const __m128i used =
+      _mm_cmpgt_epi32(_mm_set1_epi32(num_children - g * child_group_size),
+                      lane_index);
+    const __m128 usable = _mm_castsi128_ps(
+        _mm_and_si128(used, _mm_cmpgt_epi32(widen_int8(group.score_upper), alpha_v)));
+    const __m128 masked_bound = _mm_or_ps(_mm_and_ps(usable, bound),
+                                          _mm_andnot_ps(usable, minus_infinity));
+
+    _mm_store_ps(bounds + g * child_group_size, masked_bound);
+    best = _mm_max_ps(best, masked_bound);
   }
-  assert(child);
 
-  return child;
+  best = _mm_max_ps(best, _mm_shuffle_ps(best, best, _MM_SHUFFLE(2, 3, 0, 1)));
+  best = _mm_max_ps(best, _mm_shuffle_ps(best, best, _MM_SHUFFLE(1, 0, 3, 2)));
+  assert(_mm_cvtss_f32(best) > -HUGE_VALF);
+
+  // First child with the best bound.
+  for (int g = 0; g < num_groups; ++g) {
+    const int mask =
+      _mm_movemask_ps(_mm_cmpeq_ps(_mm_load_ps(bounds + g * child_group_size), best));
+    if (mask) return g * child_group_size + __builtin_ctz(mask);
+  }
+  assert(false);
+  return 0;
 }
 
-inline Move PlayerMcts::rollout_move_select(const Position &, Bitboard moves) {
+inline Move PlayerMcts::rollout_move_select(const Position &, Bitboard moves,
+                                            RandomGenerator &rng) {
   const Bitboard corner_moves = moves & corners;
   if (corner_moves) moves = corner_moves;
-  return random_generator.get_square(moves);
+  return rng.get_square(moves);
 }
 
 Move PlayerMcts::final_move_select() {
   if (root->visited_children == 0) {
     log_info("Root has no visited children!\n");
-    return random_generator.get_square(root->position.valid_moves());
+    return random_generators[0].get_square(root->position.valid_moves());
   }
 
-  std::pair<double, MiniMctsNode*> sorted_children[max_moves];
-  MiniMctsNode *const children = allocator.decompress(root->children);
+  std::pair<double, int> sorted_children[max_moves];
+  const ChildGroup *const children = allocator->decompress(root->children);
   for (int i = 0; i < root->visited_children; ++i) {
-    MiniMctsNode *const child = children + i;
+    const ChildGroup &group = children[i / child_group_size];
+    const int lane = i % child_group_size;
     // Secure child score.
     double score;
-    if (child->num_games == 0) {
+    if (group.num_games[lane] == 0) {
       score = -1e100;
     } else {
-      score = child->average_score();
-      score = std::fmin(score, child->score_upper);
-      score -= secure_child_coefficient / sqrt(child->num_games);
-      score = std::fmax(score, child->score_lower);
+      score = group.average_score[lane];
+      score = std::fmin(score, group.score_upper[lane]);
+      score -= secure_child_coefficient / sqrt(group.num_games[lane]);
+      score = std::fmax(score, group.score_lower[lane]);
     }
-    sorted_children[i] = std::pair<double, MiniMctsNode*>(score, child);
+    sorted_children[i] = std::pair<double, int>(score, i);
   }
 
   std::sort(sorted_children, sorted_children + root->visited_children,
-            [](const std::pair<double, MiniMctsNode*> &a,
-               const std::pair<double, MiniMctsNode*> &b) {
+            [](const std::pair<double, int> &a,
+               const std::pair<double, int> &b) {
               return a.first > b.first;
             });
 
   log_info("Best moves:");
   for (int i=0; i < root->visited_children && i < 3; ++i) {
-    const MiniMctsNode *const child = sorted_children[i].second;
-    if (child->num_games == 0) continue;
-    log_info(" %s", move_to_string(child->move).c_str());
-    if (child->score_lower >= child->score_upper) {
-      log_info(" [%d]", int{child->score_lower});
+    const int child_idx = sorted_children[i].second;
+    const ChildGroup &group = children[child_idx / child_group_size];
+    const int lane = child_idx % child_group_size;
+    if (group.num_games[lane] == 0) continue;
+    log_info(" %s", move_to_string(group.move[lane]).c_str());
+    if (group.score_lower[lane] >= group.score_upper[lane]) {
+      log_info(" [%d]", int{group.score_lower[lane]});
     } else {
-      if (child->score_lower > -max_score || child->score_upper < max_score) {
-        log_info(" [%d - %d]", int{child->score_lower}, int{child->score_upper});
+      if (group.score_lower[lane] > -max_score || group.score_upper[lane] < max_score) {
+        log_info(" [%d - %d]",
+                 int{group.score_lower[lane]}, int{group.score_upper[lane]});
       }
-      double score = child->average_score();
-      score = fmax(score, child->score_lower);
-      score = fmin(score, child->score_upper);
+      double score = group.average_score[lane];
+      score = fmax(score, group.score_lower[lane]);
+      score = fmin(score, group.score_upper[lane]);
       log_info(" (%.3f)", score);
     }
   }
   log_info("\n");
 
-  return sorted_children[0].second->move;
+  const int best_idx = sorted_children[0].second;
+  return children[best_idx / child_group_size].move[best_idx % child_group_size];
 }
 
 void PlayerMcts::evaluate_node(MctsNode &node) {
@@ -389,3 +633,17 @@ inline PlayerMcts::MctsNode::MctsNode(const Position &position) :
     evaluate_node(*this);
   }
 }
+
+inline PlayerMcts::MctsNode::MctsNode(const MctsNode &other) :
+    position{other.position},
+    num_games{other.num_games},
+    total_milliscore{other.total_milliscore},
+    unvisited_moves{other.unvisited_moves},
+    children{other.children},
+    score_lower{other.score_lower},
+    score_upper{other.score_upper},
+    num_children{other.num_children},
+    visited_children{other.visited_children},
+    children_capacity{other.children_capacity}
+{
+}
@@ -1,25 +1,38 @@
 #ifndef PLAYER_MCTS_H
 #define PLAYER_MCTS_H
 
+#include "endgame_cache.h"
 #include "evaluator.h"
 #include "hashing.h"
 #include "player.h"
 #include "pool_allocator.h"
 #include "position.h"
 #include "random.h"
+#include "spin_lock.h"
 #include <cmath>
 #include <cstdint>
+#include <vector>
 
 class PlayerMcts : public Player {
 public:
-  PlayerMcts();
+  // Uses 2 * _semispace_size bytes for the tree, up to 2 * 32 GB.
+  explicit PlayerMcts(int _num_threads = 1,
+                      std::size_t _semispace_size = default_semispace_size);
+
+  static constexpr std::size_t default_semispace_size = 100 << 20;
 
   Move choose_move(const Position &position,
                    const PlaySettings &settings) override;
 
+  // Drops the tree. The endgame cache only holds exact scores, so it's kept.
+  bool new_game() override;
+
+  // Can be shared with PlayerAB::set_endgame_cache.
+  EndgameCache &get_endgame_cache() { return endgame_cache; }
+
 private:
-  static constexpr std::size_t pool_allocator_size = 200 << 20;
-  static constexpr std::size_t mcts_node_lookup_buckets = 1<<20;
+  // Enough lookup buckets for nodes with one group of children each.
+  static std::size_t mcts_node_lookup_buckets(std::size_t semispace_size);
 
   static constexpr long precompute_tables_size = 100000;
   static constexpr double ucb_coefficient = 4.0;
@@ -27,6 +40,9 @@ private:
   static constexpr double secure_child_coefficient = 10.0;
   static constexpr int min_games_to_expand = 1;
   static constexpr int alpha_beta_move_number = 59;
+  static constexpr std::size_t endgame_cache_entries = 1<<20;
+  // Simulations in progress in other threads count as this big a loss.
+  static constexpr double virtual_loss_score = 32.0;
 
   static constexpr int normal_allocation = 10;
   static constexpr int think_longer_move_number = 52;
@@ -38,53 +54,92 @@ private:
 
   struct MctsNode;
 
-  struct MiniMctsNode {
-    MiniMctsNode() {}
-    MiniMctsNode(const Move _move):
-      num_games{0},
-      total_milliscore{0},
-      full_node{},
-      move{_move},
-      score_lower{-max_score},
-      score_upper{max_score}
-    {}
-
-    double average_score() const {
-      return std::ldexp(total_milliscore, -milliscore_bits) / num_games;
-    }
-
-    std::int64_t num_games;
-    std::int64_t total_milliscore;
-    CompressedPtr<MctsNode> full_node;
-    Move move;
-    Score score_lower;
-    Score score_upper;
+  static constexpr int child_group_size = 4;
+
+  // Statistics of child_group_size children in one cache line, as structure
+  // of arrays so that tree_move_select can compute bounds with SIMD.
+  struct alignas(64) ChildGroup {
+    // Average score of the games played through each child, updated by
+    // (score - average) / games. Every update rounds to float, so after n
+    // games the average is off by at most n * 2^-24 * |average|, and
+    // typically by sqrt(n) times that: about 0.001 disc at 10^5 games.
+    // Exact totals don't fit in the cache line next to the rest.
+    float average_score[child_group_size];
+    std::int32_t num_games[child_group_size];
+    CompressedPtr<MctsNode> full_node[child_group_size];
+    // Simulations currently going through each child.
+    std::int8_t virtual_losses[child_group_size];
+    Score score_lower[child_group_size];
+    Score score_upper[child_group_size];
+    Move move[child_group_size];
   };
+  static_assert(sizeof(ChildGroup) == 64, "");
+
+  static void init_child(ChildGroup &group, const int lane, const Move move) {
+    group.average_score[lane] = 0.0f;
+    group.num_games[lane] = 0;
+    group.full_node[lane] = CompressedPtr<MctsNode>{};
+    group.virtual_losses[lane] = 0;
+    group.score_lower[lane] = -max_score;
+    group.score_upper[lane] = max_score;
+    group.move[lane] = move;
+  }
 
+  static std::int64_t total_milliscore(const ChildGroup &group, const int lane) {
+    return std::llround(std::ldexp(
+        double{group.average_score[lane]} * group.num_games[lane],
+        milliscore_bits));
+  }
+
+  static int round_up_to_groups(const int num_children) {
+    return (num_children + child_group_size - 1) / child_group_size * child_group_size;
+  }
+
+  // Everything except position is protected by lock.
   struct MctsNode {
     explicit MctsNode(const Position &position);
+    // Copies everything except the lock. Only while no other thread runs.
+    MctsNode(const MctsNode &other);
 
     Position position;
     std::int64_t num_games;
     std::int64_t total_milliscore;
     Bitboard unvisited_moves;
-    CompressedPtr<MiniMctsNode> children;
+    CompressedPtr<ChildGroup> children;
     Score score_lower;
     Score score_upper;
     std::int8_t num_children;
     std::int8_t visited_children;
+    // Multiple of child_group_size.
     std::int8_t children_capacity;
+    SpinLock lock;
   };
 
   void allocate_resources(const Position &position,
                           const PlaySettings &settings);
+  // Keep only the subtree of position, moved to the other semispace.
+  void reroot(const Position &position);
+  MctsNode *copy_subtree(const PoolAllocator &old_allocator,
+                         const MctsNode &old_node);
   MctsNode *find_or_allocate_node(const Position &position);
   void explore_root();
-  void explore(MctsNode &node, Score alpha, Score beta);
-  Score random_rollout(const Position &position);
+  void explore_thread(RandomGenerator &rng, std::int64_t &num_simulations);
+  void explore(MctsNode &node, Score alpha, Score beta, RandomGenerator &rng);
+  // Average of a batch of random games.
+  Milliscore random_rollout(const Position &position, RandomGenerator &rng);
+  // alpha_beta memoized in endgame_cache. Only for alpha_beta_move_number
+  // leaves: inner nodes rarely repeat and cost a cache miss each.
+  Score cached_alpha_beta(const Position &position, Score alpha, Score beta);
   Score alpha_beta(const Position &position, Score alpha, Score beta);
-  MiniMctsNode *tree_move_select(MctsNode &node, Score alpha);
-  Move rollout_move_select(const Position &position, Bitboard moves);
+  // Returns child index. Call with node.lock held.
+  int tree_move_select(MctsNode &node, Score alpha, RandomGenerator &rng);
+  // Index of the child with the highest upper confidence bound, the first
+  // one on ties. Children that can't beat alpha are skipped. Children
+  // without games or virtual losses come first.
+  static int best_bound_child(const ChildGroup *children, int num_children,
+                              Score alpha, float exploration);
+  Move rollout_move_select(const Position &position, Bitboard moves,
+                           RandomGenerator &rng);
   Move final_move_select();
   static void evaluate_node(MctsNode &node);
 
@@ -96,10 +151,6 @@ private:
     return ucb_coefficient * std::sqrt(std::log(num_games));
   }
 
-  static double raw_child_uncertainty(const std::int64_t num_visits) {
-    return 1.0 / std::sqrt(num_visits);
-  }
-
   double root_exploration_factor(const std::int64_t num_games) const {
     return
       num_games < precompute_tables_size ?
@@ -114,23 +165,25 @@ private:
       raw_exploration_factor(num_games);
   }
 
-  double child_uncertainty(const std::int64_t num_visits) const {
-    return
-      num_visits < precompute_tables_size ?
-      child_uncertainty_table[num_visits] :
-      raw_child_uncertainty(num_visits);
-  }
-
-  RandomGenerator random_generator;
-  PoolAllocator allocator;
+  int num_threads;
+  // One per thread.
+  std::vector<RandomGenerator> random_generators;
+  // Before each move, nodes still reachable are copied to the other semispace.
+  PoolAllocator semispaces[2];
+  // Current semispace.
+  PoolAllocator *allocator;
   PositionHashTable<CompressedPtr<MctsNode>> mcts_node_lookup;
+  SpinLock mcts_node_lookup_lock;
+  // Shared by all threads, kept across moves.
+  EndgameCache endgame_cache;
 
   Timestamp deadline;
   MctsNode *root;
 
   std::vector<double> root_exploration_factor_table;
   std::vector<double> exploration_factor_table;
-  std::vector<double> child_uncertainty_table;
+
+  friend struct PlayerMctsTest;
 };
 
 #endif
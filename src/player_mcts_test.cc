@@ -0,0 +1,253 @@
+#include "clock.h"
+#include "player_mcts.h"
+#include "random.h"
+#include "tests.h"
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+  struct NodeSnapshot {
+    std::int64_t num_games;
+    std::int64_t total_milliscore;
+    Score score_lower;
+    Score score_upper;
+    int num_children;
+    // For each visited child: move, games, and the position of its full
+    // node, or an empty position.
+    std::vector<std::tuple<Move, std::int32_t, Position>> children;
+  };
+
+  using Snapshots = std::map<std::pair<Bitboard, Bitboard>, NodeSnapshot>;
+}
+
+struct PlayerMctsTest {
+  using ChildGroup = PlayerMcts::ChildGroup;
+  using MctsNode = PlayerMcts::MctsNode;
+  static constexpr int child_group_size = PlayerMcts::child_group_size;
+
+  static int best_bound_child(const ChildGroup *const children,
+                              const int num_children,
+                              const Score alpha,
+                              const float exploration) {
+    return PlayerMcts::best_bound_child(children, num_children, alpha,
+                                        exploration);
+  }
+
+  // The UCB formula one child at a time, in the same float operations.
+  static int scalar_best_bound_child(const ChildGroup *const children,
+                                     const int num_children,
+                                     const Score alpha,
+                                     const float exploration) {
+    const float virtual_loss = static_cast<float>(PlayerMcts::virtual_loss_score);
+    int best = -1;
+    float best_bound = 0.0f;
+    for (int i = 0; i < num_children; ++i) {
+      const ChildGroup &group = children[i / child_group_size];
+      const int lane = i % child_group_size;
+      if (group.score_upper[lane] <= alpha) continue;
+      const float games = static_cast<float>(group.num_games[lane]);
+      const float losses = static_cast<float>(group.virtual_losses[lane]);
+      const float visits = games + losses;
+      const float bound =
+        visits == 0.0f ? HUGE_VALF :
+        (group.average_score[lane] * games - losses * virtual_loss) / visits +
+        exploration * (1.0f / std::sqrt(visits));
+      if (best < 0 || bound > best_bound) {
+        best = i;
+        best_bound = bound;
+      }
+    }
+    return best;
+  }
+
+  static const MctsNode *root(const PlayerMcts &mcts) {
+    return mcts.root;
+  }
+
+  // Visited children with a full node.
+  static std::vector<const MctsNode*> expanded_children(
+      const PlayerMcts &mcts, const MctsNode &node) {
+    std::vector<const MctsNode*> res;
+    const ChildGroup *const children = mcts.allocator->decompress(node.children);
+    for (int i = 0; i < node.visited_children; ++i) {
+      const ChildGroup &group = children[i / child_group_size];
+      const int lane = i % child_group_size;
+      if (!group.full_node[lane].is_null()) {
+        res.push_back(mcts.allocator->decompress(group.full_node[lane]));
+      }
+    }
+    return res;
+  }
+
+  // Checks that every node is in the current semispace and in the lookup
+  // table.
+  static void take_snapshots(const PlayerMcts &mcts,
+                             const MctsNode &node,
+                             Snapshots &snapshots) {
+    assert(mcts.allocator->contains(&node));
+    const CompressedPtr<MctsNode> *const lookup =
+      mcts.mcts_node_lookup.find(node.position);
+    assert(lookup && mcts.allocator->decompress(*lookup) == &node);
+    const auto key = std::make_pair(node.position.player, node.position.opponent);
+    if (snapshots.count(key)) return;
+    NodeSnapshot &snapshot = snapshots[key];
+    snapshot.num_games = node.num_games;
+    snapshot.total_milliscore = node.total_milliscore;
+    snapshot.score_lower = node.score_lower;
+    snapshot.score_upper = node.score_upper;
+    snapshot.num_children = node.num_children;
+    const ChildGroup *const children = mcts.allocator->decompress(node.children);
+    if (node.visited_children > 0) assert(mcts.allocator->contains(children));
+    for (int i = 0; i < node.visited_children; ++i) {
+      const ChildGroup &group = children[i / child_group_size];
+      const int lane = i % child_group_size;
+      const MctsNode *const child =
+        mcts.allocator->decompress(group.full_node[lane]);
+      snapshot.children.emplace_back(group.move[lane], group.num_games[lane],
+                                     child ? child->position : Position{});
+      if (child) take_snapshots(mcts, *child, snapshots);
+    }
+  }
+
+  static void reroot(PlayerMcts &mcts, const Position &position) {
+    mcts.reroot(position);
+  }
+
+  static const MctsNode *find_node(const PlayerMcts &mcts,
+                                   const Position &position) {
+    const CompressedPtr<MctsNode> *const lookup =
+      mcts.mcts_node_lookup.find(position);
+    return lookup ? mcts.allocator->decompress(*lookup) : nullptr;
+  }
+
+  static std::size_t num_lookup_nodes(const PlayerMcts &mcts) {
+    return mcts.mcts_node_lookup.size();
+  }
+};
+
+namespace {
+  using ChildGroup = PlayerMctsTest::ChildGroup;
+  constexpr int child_group_size = PlayerMctsTest::child_group_size;
+  constexpr int max_groups = (max_moves + child_group_size - 1) / child_group_size;
+
+  void set_child(ChildGroup *const children, const int i,
+                 const float average_score, const std::int32_t num_games,
+                 const std::int8_t virtual_losses, const Score score_upper) {
+    ChildGroup &group = children[i / child_group_size];
+    const int lane = i % child_group_size;
+    group.average_score[lane] = average_score;
+    group.num_games[lane] = num_games;
+    group.virtual_losses[lane] = virtual_losses;
+    group.score_lower[lane] = -max_score;
+    group.score_upper[lane] = score_upper;
+  }
+
+  void check_same_child(const ChildGroup *const children,
+                        const int num_children,
+                        const Score alpha,
+                        const float exploration) {
+    const int simd = PlayerMctsTest::best_bound_child(
+        children, num_children, alpha, exploration);
+    const int scalar = PlayerMctsTest::scalar_best_bound_child(
+        children, num_children, alpha, exploration);
+    assert(simd == scalar);
+  }
+}
+
+TEST(test_mcts_best_bound_child) {
+  RandomGenerator rng;
+  for (int iteration = 0; iteration < 10000; ++iteration) {
+    // Often not a multiple of the group size.
+    const int num_children = 1 + rng.get_int(max_moves);
+    const Score alpha = static_cast<Score>(rng.get_int(9) - 4);
+    const float exploration = 0.5f * static_cast<float>(rng.get_int(16));
+    ChildGroup children[max_groups] = {};
+    for (int i = 0; i < max_groups * child_group_size; ++i) {
+      // Few distinct values, so that there are ties. Unused lanes look like
+      // the best children, so they'd win if they weren't masked.
+      const bool used = i < num_children;
+      const std::int8_t virtual_losses =
+        static_cast<std::int8_t>(rng.get_int(4) == 0 ? rng.get_int(3) : 0);
+      const std::int32_t num_games =
+        !used ? 0 : rng.get_int(4) == 0 ? 0 : 1 << rng.get_int(12);
+      set_child(children, i,
+                used ? static_cast<float>(rng.get_int(9) - 4) : 64.0f,
+                num_games,
+                used ? virtual_losses : 0,
+                static_cast<Score>(used ? rng.get_int(13) - 6 : max_score));
+    }
+    // Some child must be able to beat alpha.
+    set_child(children, rng.get_int(num_children),
+              0.0f, 16, 0, max_score);
+    check_same_child(children, num_children, alpha, exploration);
+  }
+
+  // Ties go to the first child.
+  ChildGroup children[max_groups] = {};
+  for (int i = 0; i < 7; ++i) set_child(children, i, 1.5f, 100, 0, max_score);
+  assert(PlayerMctsTest::best_bound_child(children, 7, 0, 1.0f) == 0);
+  set_child(children, 0, 1.5f, 100, 0, -1);
+  assert(PlayerMctsTest::best_bound_child(children, 7, 0, 1.0f) == 1);
+
+  // Without games or virtual losses a child comes first.
+  set_child(children, 5, 0.0f, 0, 0, max_score);
+  assert(PlayerMctsTest::best_bound_child(children, 7, 0, 1.0f) == 5);
+  check_same_child(children, 7, 0, 1.0f);
+
+  // Only virtual losses.
+  set_child(children, 5, 0.0f, 0, 1, max_score);
+  check_same_child(children, 7, 0, 1.0f);
+  assert(PlayerMctsTest::best_bound_child(children, 7, 0, 1.0f) != 5);
+}
+
+TEST(test_mcts_reroot) {
+  PlayerMcts mcts{1, std::size_t{8} << 20};
+  PlaySettings settings;
+  settings.start_time = current_time();
+  settings.time_left = std::chrono::milliseconds{300};
+  settings.use_all_resources = true;
+  settings.use_book = false;
+  mcts.choose_move(Position::initial(), settings);
+
+  // The grandchild with the most games.
+  const PlayerMctsTest::MctsNode *grandchild = nullptr;
+  for (const auto *const child :
+       PlayerMctsTest::expanded_children(mcts, *PlayerMctsTest::root(mcts))) {
+    for (const auto *const node : PlayerMctsTest::expanded_children(mcts, *child)) {
+      if (!grandchild || node->num_games > grandchild->num_games) {
+        grandchild = node;
+      }
+    }
+  }
+  assert(grandchild && grandchild->num_games > 1);
+  const Position position = grandchild->position;
+
+  Snapshots before;
+  PlayerMctsTest::take_snapshots(mcts, *grandchild, before);
+  assert(before.size() > 1);
+
+  PlayerMctsTest::reroot(mcts, position);
+
+  // The same subtree, all in the new semispace, and nothing else.
+  const PlayerMctsTest::MctsNode *const new_root =
+    PlayerMctsTest::find_node(mcts, position);
+  assert(new_root && new_root != grandchild);
+  Snapshots after;
+  PlayerMctsTest::take_snapshots(mcts, *new_root, after);
+  assert(after.size() == before.size());
+  for (const auto &entry : before) {
+    const NodeSnapshot &a = entry.second;
+    const NodeSnapshot &b = after.at(entry.first);
+    assert(a.num_games == b.num_games);
+    assert(a.total_milliscore == b.total_milliscore);
+    assert(a.score_lower == b.score_lower && a.score_upper == b.score_upper);
+    assert(a.num_children == b.num_children);
+    assert(a.children == b.children);
+  }
+  assert(PlayerMctsTest::num_lookup_nodes(mcts) == before.size());
+  assert(!PlayerMctsTest::find_node(mcts, Position::initial()));
+}
@@ -1,12 +1,17 @@
 #include "pool_allocator.h"
+#include "large_memory.h"
 #include "logging.h"
+#include <algorithm>
 #include <memory>
 
 PoolAllocator::PoolAllocator(const std::size_t _capacity) :
     m_capacity{_capacity},
     m_limit{_capacity},
-    m_out_of_memory{false} {
-  m_mem = reinterpret_cast<std::uintptr_t>(std::malloc(_capacity));
+    m_out_of_memory{false},
+    m_num_allocations{0},
+    m_bytes_requested{0} {
+  assert(_capacity <= max_pool_allocator_capacity);
+  m_mem = reinterpret_cast<std::uintptr_t>(allocate_large(_capacity));
   assert(m_mem);
   log_info("PoolAllocator allocated %.2f MB\n",
       static_cast<double>(m_capacity) / (1<<20));
@@ -14,16 +19,23 @@ PoolAllocator::PoolAllocator(const std::size_t _capacity) :
 }
 
 PoolAllocator::~PoolAllocator() {
-  std::free(reinterpret_cast<void*>(m_mem));
+  free_large(reinterpret_cast<void*>(m_mem), m_capacity);
 }
 
-char *PoolAllocator::allocate_raw(const std::size_t size, const std::size_t align) {
-  const std::uintptr_t next = (m_next + align - 1u) & ~(align-1u);
-  const std::uintptr_t end = next + size;
-  if (end - m_mem > m_limit) {
-    m_out_of_memory = true;
-    return nullptr;
+char *PoolAllocator::allocate_raw(const std::size_t size, std::size_t align) {
+  align = std::max(align, compressed_ptr_granularity);
+  std::uintptr_t old_next = m_next.load(std::memory_order_relaxed);
+  for (;;) {
+    const std::uintptr_t next = (old_next + align - 1u) & ~(align-1u);
+    const std::uintptr_t end = next + size;
+    if (end - m_mem > m_limit) {
+      m_out_of_memory = true;
+      return nullptr;
+    }
+    if (m_next.compare_exchange_weak(old_next, end, std::memory_order_relaxed)) {
+      m_num_allocations.fetch_add(1, std::memory_order_relaxed);
+      m_bytes_requested.fetch_add(size, std::memory_order_relaxed);
+      return reinterpret_cast<char*>(next);
+    }
   }
-  m_next = end;
-  return reinterpret_cast<char*>(next);
 }
@@ -2,11 +2,19 @@
 #define POOL_ALLOCATOR_H
 
 #include "arch.h"
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <cstdlib>
 #include <utility>
 
+// Offsets are stored in units of compressed_ptr_granularity bytes, which
+// lets 4-byte links address pools of up to 32 GB.
+constexpr int compressed_ptr_shift = 3;
+constexpr std::size_t compressed_ptr_granularity = std::size_t{1} << compressed_ptr_shift;
+constexpr std::size_t max_pool_allocator_capacity =
+  std::size_t{0xffffffffu} << compressed_ptr_shift;
+
 template<typename T>
 class CompressedPtr {
 public:
@@ -18,13 +26,15 @@ private:
   friend class PoolAllocator;
 };
 
+// allocate and construct are thread-safe. Every allocation is aligned to at
+// least compressed_ptr_granularity.
 class PoolAllocator {
 public:
   explicit PoolAllocator(std::size_t _capacity);
   ~PoolAllocator();
 
   std::size_t capacity() const { return m_capacity; }
-  std::size_t used() const { return m_next - m_mem; }
+  std::size_t used() const { return m_next.load(std::memory_order_relaxed) - m_mem; }
   std::size_t limit() const { return m_limit; }
 
   void set_limit(const std::size_t _limit) {
@@ -35,6 +45,24 @@ public:
 
   bool out_of_memory() const { return m_out_of_memory; }
 
+  // Statistics since construction or clear.
+  std::size_t num_allocations() const {
+    return m_num_allocations.load(std::memory_order_relaxed);
+  }
+  std::size_t bytes_requested() const {
+    return m_bytes_requested.load(std::memory_order_relaxed);
+  }
+  // Lost to alignment.
+  std::size_t padding() const { return used() - bytes_requested(); }
+
+  // Forget all allocations. Not thread-safe.
+  void clear() {
+    m_next = m_mem;
+    m_out_of_memory = false;
+    m_num_allocations = 0;
+    m_bytes_requested = 0;
+  }
+
   template<typename T>
   T *allocate(std::size_t n = 1) {
     return reinterpret_cast<T*>(allocate_raw(n * sizeof(T), alignof(T)));
@@ -49,29 +77,39 @@ public:
     return p;
   }
 
+  // Whether p points into memory allocated since the last clear.
+  bool contains(const void *const p) const {
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(p);
+    return address >= m_mem && address < m_next.load(std::memory_order_relaxed);
+  }
+
   template<typename T>
   CompressedPtr<T> compress(T *p) const {
     if (!p) return CompressedPtr<T>{};
-    const std::uint32_t offset =
-        reinterpret_cast<std::uintptr_t>(p) - m_mem;
-    return CompressedPtr<T>{offset + 1u};
+    const std::uintptr_t offset = reinterpret_cast<std::uintptr_t>(p) - m_mem;
+    assert(offset % compressed_ptr_granularity == 0);
+    return CompressedPtr<T>{
+      static_cast<std::uint32_t>(offset >> compressed_ptr_shift) + 1u};
   }
 
   template<typename T>
   T *decompress(const CompressedPtr<T> cp) const {
     if (cp.is_null()) return nullptr;
-    else return reinterpret_cast<T*>(m_mem + cp.p - 1u);
+    else return reinterpret_cast<T*>(
+        m_mem + (std::uintptr_t{cp.p - 1u} << compressed_ptr_shift));
   }
 
 private:
   char *allocate_raw(std::size_t size, std::size_t align);
 
   std::uintptr_t m_mem;
-  std::uintptr_t m_next;
+  std::atomic<std::uintptr_t> m_next;
   std::size_t m_capacity;
   std::size_t m_limit;
 
-  bool m_out_of_memory;
+  std::atomic<bool> m_out_of_memory;
+  std::atomic<std::size_t> m_num_allocations;
+  std::atomic<std::size_t> m_bytes_requested;
 };
 
 #endif
@@ -1,5 +1,7 @@
 #include "pool_allocator.h"
 #include "tests.h"
+#include <thread>
+#include <vector>
 
 TEST(test_pool_allocator) {
   PoolAllocator alloc(16);
@@ -14,8 +16,18 @@ TEST(test_pool_allocator) {
   assert(b && *b == 8);
   assert(reinterpret_cast<std::uintptr_t>(b) % 8u == 0u);
   assert(alloc.used() == 16);
+  assert(alloc.num_allocations() == 2);
+  assert(alloc.bytes_requested() == 12);
+  assert(alloc.padding() == 4);
 
   assert(!alloc.allocate<char>());
+
+  alloc.clear();
+  assert(alloc.used() == 0);
+  assert(!alloc.out_of_memory());
+  assert(alloc.num_allocations() == 0);
+  int *c = alloc.construct<int>(9);
+  assert(c == a && *c == 9);
 }
 
 TEST(test_compressed_ptr) {
@@ -29,4 +41,46 @@ TEST(test_compressed_ptr) {
   const CompressedPtr<int> ca = alloc.compress(a);
   assert(!ca.is_null());
   assert(alloc.decompress(ca) == a);
+
+  // Even small objects are aligned, so they can be compressed.
+  char *b = alloc.construct<char>('b');
+  assert(b && alloc.decompress(alloc.compress(b)) == b);
+}
+
+TEST(test_compressed_ptr_range) {
+  // Past 4 GB. Pages are only touched where we write.
+  const std::size_t capacity = std::size_t{6} << 30;
+  PoolAllocator alloc(capacity);
+  char *const first = alloc.allocate<char>(capacity - 64);
+  assert(first);
+  std::int64_t *const last = alloc.construct<std::int64_t>(42);
+  assert(last);
+  const CompressedPtr<std::int64_t> cp = alloc.compress(last);
+  assert(alloc.decompress(cp) == last && *last == 42);
+}
+
+TEST(test_pool_allocator_threads) {
+  constexpr int num_threads = 4;
+  constexpr int per_thread = 1000;
+  PoolAllocator alloc(num_threads * per_thread * sizeof(std::int64_t));
+  std::int64_t *allocated[num_threads][per_thread];
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&alloc, &allocated, t]() {
+      for (int i = 0; i < per_thread; ++i) {
+        allocated[t][i] = alloc.construct<std::int64_t>(t * per_thread + i);
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+
+  assert(alloc.used() == num_threads * per_thread * sizeof(std::int64_t));
+  assert(alloc.num_allocations() == num_threads * per_thread);
+  assert(!alloc.out_of_memory());
+  for (int t = 0; t < num_threads; ++t) {
+    for (int i = 0; i < per_thread; ++i) {
+      assert(allocated[t][i] && *allocated[t][i] == t * per_thread + i);
+    }
+  }
 }
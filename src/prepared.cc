@@ -1,6 +1,8 @@
 #include "prepared.h"
+#include "hashing.h"
+#include <memory>
 
-const Prepared prepared_games[] = {
+extern const Prepared prepared_games[] = {
   // white vs first0 (x2, 50M/56)
   { 0,28, {-1,-1,-1,-1,20,19,10,11,1,3,34,12,4,2,0,5,6,9,26,8,21,13,33,14,32,7,40,15,48,23,56,24,16,25,17,29,43,18,50,22,45,30,44,31,39,37,52,38,54,41,63,42,46,47,57,49,55,51,59,53,58,60,61,62,}},
   // white vs first3 (50M/56)
@@ -36,18 +38,40 @@ const Prepared prepared_games[] = {
   { 1,32, {-1,-1,-1,-1,29,19,42,30,11,49,31,56,34,21,37,33,32,26,12,38,44,40,47,53,41,57,50,17,24,58,10,59,60,61,62,16,14,18,8,63,48,39,45,7,2,23,15,0,4,5,1,46,6,3,9,55,22,25,13,52,54,20,43,51,}},
 };
 
-Move find_prepared_game(int move_number,
-                        const Move (&moves_so_far)[num_squares]) {
-  for (const Prepared &game : prepared_games) {
-    if (game.color != move_number % 2) continue;
-    bool match = true;
-    for (int i=4; i<move_number; ++i) {
-      if(moves_so_far[i] != game.moves[i]) {
-        match = false;
-        break;
+extern const size_t num_prepared_games =
+  sizeof(prepared_games) / sizeof(prepared_games[0]);
+
+namespace {
+  // Moves in the normalized position's frame.
+  std::unique_ptr<PositionHashTable<Move>> prepared_index;
+}
+
+void init_prepared() {
+  prepared_index = std::make_unique<PositionHashTable<Move>>(1u << 10, true);
+  for (size_t i = 0; i < num_prepared_games; ++i) {
+    const Prepared &game = prepared_games[i];
+    Position position = Position::initial();
+    while (!position.finished()) {
+      const Move move = game.moves[position.move_number()];
+      assert(get_bit(position.valid_moves(), move));
+      if (position.to_move() == game.color) {
+        Position normalized_position;
+        const int symmetry = position.normalize(normalized_position);
+        bool inserted;
+        prepared_index->insert(normalized_position, inserted,
+                               static_cast<Move>(transform_square(move, symmetry)));
       }
+      position.make_move(move, position);
     }
-    if (match) return game.moves[move_number];
   }
-  return invalid_move;
+  log_info("Prepared positions: %zu\n", prepared_index->size());
+}
+
+Move find_prepared_move(const Position &position) {
+  assert(prepared_index);
+  Position normalized_position;
+  const int symmetry = position.normalize(normalized_position);
+  const Move *const move = prepared_index->find(normalized_position);
+  if (!move) return invalid_move;
+  return untransform_square(*move, symmetry);
 }
@@ -9,8 +9,17 @@ struct Prepared {
   Move moves[num_squares];
 };
 
-// invalid_move if not found
-Move find_prepared_game(int move_number,
-                        const Move (&moves_so_far)[num_squares]);
+// Source format, written by find_games.
+extern const Prepared prepared_games[];
+extern const size_t num_prepared_games;
+
+// Indexes every position of prepared_games where the prepared color is to
+// move, by normalized position. The first game wins where they disagree.
+// Requires init_hashing.
+void init_prepared();
+
+// invalid_move if not found. Matches the positions of prepared games
+// reached in any symmetry or by transposition.
+Move find_prepared_move(const Position &position);
 
 #endif
@@ -0,0 +1,26 @@
+#include "prepared.h"
+#include "tests.h"
+
+TEST(test_find_prepared_move) {
+  assert(num_prepared_games > 0);
+  const Prepared &game = prepared_games[0];
+
+  // The game played in every symmetry.
+  for (int symmetry = 0; symmetry < 8; ++symmetry) {
+    Position position = Position::initial();
+    while (!position.finished()) {
+      const Move move = game.moves[position.move_number()];
+      const Position transformed = position.transform(symmetry);
+      const Move prepared_move = find_prepared_move(transformed);
+      if (position.to_move() == game.color) {
+        assert(prepared_move != invalid_move);
+        // Another game may get there first with a different move.
+        assert(get_bit(transformed.valid_moves(), prepared_move));
+        if (symmetry == 0 && position.move_number() == 4) {
+          assert(prepared_move == move);
+        }
+      }
+      position.make_move(move, position);
+    }
+  }
+}
@@ -7,9 +7,15 @@ constexpr int min_probcut_depth = 2;
 constexpr int max_probcut_depth = 8;
 constexpr double probcut_stddevs = 1.3;
 
+// Linear model of the deep search score given the shallow one, fitted by
+// eval_correlations:
+//   deep = slope * shallow + intercept + error, error has stddev.
+// A search at depth deep fails high with enough confidence when
+//   shallow >= (beta - intercept + probcut_stddevs * stddev) / slope.
 struct ProbCutInfo {
   int shallow_depth; // -1 for no probcut
-  double offset; // shallow - deep
+  double slope; // > 0
+  double intercept;
   double stddev;
 };
 
@@ -7,63 +7,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-13044.2,92074.1},
+    {0,1,13044.2,92074.1},
   },
   // deep = 2
   {
-    {0,1484.37,124976},
-    {1,14528.5,43147.5},
+    {0,1,-1484.37,124976},
+    {1,1,-14528.5,43147.5},
   },
   // deep = 3
   {
-    {0,-17347.1,145539},
-    {1,-4302.94,74351.3},
-    {2,-18831.5,42972.2},
+    {0,1,17347.1,145539},
+    {1,1,4302.94,74351.3},
+    {2,1,18831.5,42972.2},
   },
   // deep = 4
   {
-    {0,3953.91,150408},
-    {1,16998.1,86200.4},
-    {2,2469.53,57671.6},
-    {3,21301,28336.5},
+    {0,1,-3953.91,150408},
+    {1,1,-16998.1,86200.4},
+    {2,1,-2469.53,57671.6},
+    {3,1,-21301,28336.5},
   },
   // deep = 5
   {
-    {0,-16857.5,154353},
-    {1,-3813.34,99468.7},
-    {2,-18341.9,79531.1},
-    {3,489.602,59355},
-    {4,-20811.4,45969.9},
+    {0,1,16857.5,154353},
+    {1,1,3813.34,99468.7},
+    {2,1,18341.9,79531.1},
+    {3,1,-489.602,59355},
+    {4,1,20811.4,45969.9},
   },
   // deep = 6
   {
-    {0,4104.23,153023},
-    {1,17148.4,98397.1},
-    {2,2619.85,82771.7},
-    {3,21451.3,67424.5},
-    {4,150.32,58871},
-    {5,20961.7,30327.5},
+    {0,1,-4104.23,153023},
+    {1,1,-17148.4,98397.1},
+    {2,1,-2619.85,82771.7},
+    {3,1,-21451.3,67424.5},
+    {4,1,-150.32,58871},
+    {5,1,-20961.7,30327.5},
   },
   // deep = 7
   {
-    {0,-16159.7,156974},
-    {1,-3115.49,103025},
-    {2,-17644,89198.4},
-    {3,1187.45,74958.7},
-    {4,-20113.6,65930.2},
-    {5,697.845,36565.1},
-    {6,-20263.9,20784},
+    {0,1,16159.7,156974},
+    {1,1,3115.49,103025},
+    {2,1,17644,89198.4},
+    {3,1,-1187.45,74958.7},
+    {4,1,20113.6,65930.2},
+    {5,1,-697.845,36565.1},
+    {6,1,20263.9,20784},
   },
   // deep = 8
   {
-    {0,14078.3,157196},
-    {1,27122.5,103692},
-    {2,12593.9,89394.1},
-    {3,31425.4,75101.8},
-    {4,10124.4,66844.7},
-    {5,30935.8,41691},
-    {6,9974.09,20735.5},
-    {7,30238,18101.3},
+    {0,1,-14078.3,157196},
+    {1,1,-27122.5,103692},
+    {2,1,-12593.9,89394.1},
+    {3,1,-31425.4,75101.8},
+    {4,1,-10124.4,66844.7},
+    {5,1,-30935.8,41691},
+    {6,1,-9974.09,20735.5},
+    {7,1,-30238,18101.3},
   },
 },
 // move 1
@@ -73,63 +73,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-13044.2,92074.1},
+    {0,1,13044.2,92074.1},
   },
   // deep = 2
   {
-    {0,1484.37,124976},
-    {1,14528.5,43147.5},
+    {0,1,-1484.37,124976},
+    {1,1,-14528.5,43147.5},
   },
   // deep = 3
   {
-    {0,-17347.1,145539},
-    {1,-4302.94,74351.3},
-    {2,-18831.5,42972.2},
+    {0,1,17347.1,145539},
+    {1,1,4302.94,74351.3},
+    {2,1,18831.5,42972.2},
   },
   // deep = 4
   {
-    {0,3953.91,150408},
-    {1,16998.1,86200.4},
-    {2,2469.53,57671.6},
-    {3,21301,28336.5},
+    {0,1,-3953.91,150408},
+    {1,1,-16998.1,86200.4},
+    {2,1,-2469.53,57671.6},
+    {3,1,-21301,28336.5},
   },
   // deep = 5
   {
-    {0,-16857.5,154353},
-    {1,-3813.34,99468.7},
-    {2,-18341.9,79531.1},
-    {3,489.602,59355},
-    {4,-20811.4,45969.9},
+    {0,1,16857.5,154353},
+    {1,1,3813.34,99468.7},
+    {2,1,18341.9,79531.1},
+    {3,1,-489.602,59355},
+    {4,1,20811.4,45969.9},
   },
   // deep = 6
   {
-    {0,4104.23,153023},
-    {1,17148.4,98397.1},
-    {2,2619.85,82771.7},
-    {3,21451.3,67424.5},
-    {4,150.32,58871},
-    {5,20961.7,30327.5},
+    {0,1,-4104.23,153023},
+    {1,1,-17148.4,98397.1},
+    {2,1,-2619.85,82771.7},
+    {3,1,-21451.3,67424.5},
+    {4,1,-150.32,58871},
+    {5,1,-20961.7,30327.5},
   },
   // deep = 7
   {
-    {0,-16159.7,156974},
-    {1,-3115.49,103025},
-    {2,-17644,89198.4},
-    {3,1187.45,74958.7},
-    {4,-20113.6,65930.2},
-    {5,697.845,36565.1},
-    {6,-20263.9,20784},
+    {0,1,16159.7,156974},
+    {1,1,3115.49,103025},
+    {2,1,17644,89198.4},
+    {3,1,-1187.45,74958.7},
+    {4,1,20113.6,65930.2},
+    {5,1,-697.845,36565.1},
+    {6,1,20263.9,20784},
   },
   // deep = 8
   {
-    {0,14078.3,157196},
-    {1,27122.5,103692},
-    {2,12593.9,89394.1},
-    {3,31425.4,75101.8},
-    {4,10124.4,66844.7},
-    {5,30935.8,41691},
-    {6,9974.09,20735.5},
-    {7,30238,18101.3},
+    {0,1,-14078.3,157196},
+    {1,1,-27122.5,103692},
+    {2,1,-12593.9,89394.1},
+    {3,1,-31425.4,75101.8},
+    {4,1,-10124.4,66844.7},
+    {5,1,-30935.8,41691},
+    {6,1,-9974.09,20735.5},
+    {7,1,-30238,18101.3},
   },
 },
 // move 2
@@ -139,63 +139,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-13044.2,92074.1},
+    {0,1,13044.2,92074.1},
   },
   // deep = 2
   {
-    {0,1484.37,124976},
-    {1,14528.5,43147.5},
+    {0,1,-1484.37,124976},
+    {1,1,-14528.5,43147.5},
   },
   // deep = 3
   {
-    {0,-17347.1,145539},
-    {1,-4302.94,74351.3},
-    {2,-18831.5,42972.2},
+    {0,1,17347.1,145539},
+    {1,1,4302.94,74351.3},
+    {2,1,18831.5,42972.2},
   },
   // deep = 4
   {
-    {0,3953.91,150408},
-    {1,16998.1,86200.4},
-    {2,2469.53,57671.6},
-    {3,21301,28336.5},
+    {0,1,-3953.91,150408},
+    {1,1,-16998.1,86200.4},
+    {2,1,-2469.53,57671.6},
+    {3,1,-21301,28336.5},
   },
   // deep = 5
   {
-    {0,-16857.5,154353},
-    {1,-3813.34,99468.7},
-    {2,-18341.9,79531.1},
-    {3,489.602,59355},
-    {4,-20811.4,45969.9},
+    {0,1,16857.5,154353},
+    {1,1,3813.34,99468.7},
+    {2,1,18341.9,79531.1},
+    {3,1,-489.602,59355},
+    {4,1,20811.4,45969.9},
   },
   // deep = 6
   {
-    {0,4104.23,153023},
-    {1,17148.4,98397.1},
-    {2,2619.85,82771.7},
-    {3,21451.3,67424.5},
-    {4,150.32,58871},
-    {5,20961.7,30327.5},
+    {0,1,-4104.23,153023},
+    {1,1,-17148.4,98397.1},
+    {2,1,-2619.85,82771.7},
+    {3,1,-21451.3,67424.5},
+    {4,1,-150.32,58871},
+    {5,1,-20961.7,30327.5},
   },
   // deep = 7
   {
-    {0,-16159.7,156974},
-    {1,-3115.49,103025},
-    {2,-17644,89198.4},
-    {3,1187.45,74958.7},
-    {4,-20113.6,65930.2},
-    {5,697.845,36565.1},
-    {6,-20263.9,20784},
+    {0,1,16159.7,156974},
+    {1,1,3115.49,103025},
+    {2,1,17644,89198.4},
+    {3,1,-1187.45,74958.7},
+    {4,1,20113.6,65930.2},
+    {5,1,-697.845,36565.1},
+    {6,1,20263.9,20784},
   },
   // deep = 8
   {
-    {0,14078.3,157196},
-    {1,27122.5,103692},
-    {2,12593.9,89394.1},
-    {3,31425.4,75101.8},
-    {4,10124.4,66844.7},
-    {5,30935.8,41691},
-    {6,9974.09,20735.5},
-    {7,30238,18101.3},
+    {0,1,-14078.3,157196},
+    {1,1,-27122.5,103692},
+    {2,1,-12593.9,89394.1},
+    {3,1,-31425.4,75101.8},
+    {4,1,-10124.4,66844.7},
+    {5,1,-30935.8,41691},
+    {6,1,-9974.09,20735.5},
+    {7,1,-30238,18101.3},
   },
 },
 // move 3
@@ -205,63 +205,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-13044.2,92074.1},
+    {0,1,13044.2,92074.1},
   },
   // deep = 2
   {
-    {0,1484.37,124976},
-    {1,14528.5,43147.5},
+    {0,1,-1484.37,124976},
+    {1,1,-14528.5,43147.5},
   },
   // deep = 3
   {
-    {0,-17347.1,145539},
-    {1,-4302.94,74351.3},
-    {2,-18831.5,42972.2},
+    {0,1,17347.1,145539},
+    {1,1,4302.94,74351.3},
+    {2,1,18831.5,42972.2},
   },
   // deep = 4
   {
-    {0,3953.91,150408},
-    {1,16998.1,86200.4},
-    {2,2469.53,57671.6},
-    {3,21301,28336.5},
+    {0,1,-3953.91,150408},
+    {1,1,-16998.1,86200.4},
+    {2,1,-2469.53,57671.6},
+    {3,1,-21301,28336.5},
   },
   // deep = 5
   {
-    {0,-16857.5,154353},
-    {1,-3813.34,99468.7},
-    {2,-18341.9,79531.1},
-    {3,489.602,59355},
-    {4,-20811.4,45969.9},
+    {0,1,16857.5,154353},
+    {1,1,3813.34,99468.7},
+    {2,1,18341.9,79531.1},
+    {3,1,-489.602,59355},
+    {4,1,20811.4,45969.9},
   },
   // deep = 6
   {
-    {0,4104.23,153023},
-    {1,17148.4,98397.1},
-    {2,2619.85,82771.7},
-    {3,21451.3,67424.5},
-    {4,150.32,58871},
-    {5,20961.7,30327.5},
+    {0,1,-4104.23,153023},
+    {1,1,-17148.4,98397.1},
+    {2,1,-2619.85,82771.7},
+    {3,1,-21451.3,67424.5},
+    {4,1,-150.32,58871},
+    {5,1,-20961.7,30327.5},
   },
   // deep = 7
   {
-    {0,-16159.7,156974},
-    {1,-3115.49,103025},
-    {2,-17644,89198.4},
-    {3,1187.45,74958.7},
-    {4,-20113.6,65930.2},
-    {5,697.845,36565.1},
-    {6,-20263.9,20784},
+    {0,1,16159.7,156974},
+    {1,1,3115.49,103025},
+    {2,1,17644,89198.4},
+    {3,1,-1187.45,74958.7},
+    {4,1,20113.6,65930.2},
+    {5,1,-697.845,36565.1},
+    {6,1,20263.9,20784},
   },
   // deep = 8
   {
-    {0,14078.3,157196},
-    {1,27122.5,103692},
-    {2,12593.9,89394.1},
-    {3,31425.4,75101.8},
-    {4,10124.4,66844.7},
-    {5,30935.8,41691},
-    {6,9974.09,20735.5},
-    {7,30238,18101.3},
+    {0,1,-14078.3,157196},
+    {1,1,-27122.5,103692},
+    {2,1,-12593.9,89394.1},
+    {3,1,-31425.4,75101.8},
+    {4,1,-10124.4,66844.7},
+    {5,1,-30935.8,41691},
+    {6,1,-9974.09,20735.5},
+    {7,1,-30238,18101.3},
   },
 },
 // move 4
@@ -271,63 +271,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-13044.2,92074.1},
+    {0,1,13044.2,92074.1},
   },
   // deep = 2
   {
-    {0,1484.37,124976},
-    {1,14528.5,43147.5},
+    {0,1,-1484.37,124976},
+    {1,1,-14528.5,43147.5},
   },
   // deep = 3
   {
-    {0,-17347.1,145539},
-    {1,-4302.94,74351.3},
-    {2,-18831.5,42972.2},
+    {0,1,17347.1,145539},
+    {1,1,4302.94,74351.3},
+    {2,1,18831.5,42972.2},
   },
   // deep = 4
   {
-    {0,3953.91,150408},
-    {1,16998.1,86200.4},
-    {2,2469.53,57671.6},
-    {3,21301,28336.5},
+    {0,1,-3953.91,150408},
+    {1,1,-16998.1,86200.4},
+    {2,1,-2469.53,57671.6},
+    {3,1,-21301,28336.5},
   },
   // deep = 5
   {
-    {0,-16857.5,154353},
-    {1,-3813.34,99468.7},
-    {2,-18341.9,79531.1},
-    {3,489.602,59355},
-    {4,-20811.4,45969.9},
+    {0,1,16857.5,154353},
+    {1,1,3813.34,99468.7},
+    {2,1,18341.9,79531.1},
+    {3,1,-489.602,59355},
+    {4,1,20811.4,45969.9},
   },
   // deep = 6
   {
-    {0,4104.23,153023},
-    {1,17148.4,98397.1},
-    {2,2619.85,82771.7},
-    {3,21451.3,67424.5},
-    {4,150.32,58871},
-    {5,20961.7,30327.5},
+    {0,1,-4104.23,153023},
+    {1,1,-17148.4,98397.1},
+    {2,1,-2619.85,82771.7},
+    {3,1,-21451.3,67424.5},
+    {4,1,-150.32,58871},
+    {5,1,-20961.7,30327.5},
   },
   // deep = 7
   {
-    {0,-16159.7,156974},
-    {1,-3115.49,103025},
-    {2,-17644,89198.4},
-    {3,1187.45,74958.7},
-    {4,-20113.6,65930.2},
-    {5,697.845,36565.1},
-    {6,-20263.9,20784},
+    {0,1,16159.7,156974},
+    {1,1,3115.49,103025},
+    {2,1,17644,89198.4},
+    {3,1,-1187.45,74958.7},
+    {4,1,20113.6,65930.2},
+    {5,1,-697.845,36565.1},
+    {6,1,20263.9,20784},
   },
   // deep = 8
   {
-    {0,14078.3,157196},
-    {1,27122.5,103692},
-    {2,12593.9,89394.1},
-    {3,31425.4,75101.8},
-    {4,10124.4,66844.7},
-    {5,30935.8,41691},
-    {6,9974.09,20735.5},
-    {7,30238,18101.3},
+    {0,1,-14078.3,157196},
+    {1,1,-27122.5,103692},
+    {2,1,-12593.9,89394.1},
+    {3,1,-31425.4,75101.8},
+    {4,1,-10124.4,66844.7},
+    {5,1,-30935.8,41691},
+    {6,1,-9974.09,20735.5},
+    {7,1,-30238,18101.3},
   },
 },
 // move 5
@@ -337,63 +337,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-13044.2,92074.1},
+    {0,1,13044.2,92074.1},
   },
   // deep = 2
   {
-    {0,1484.37,124976},
-    {1,14528.5,43147.5},
+    {0,1,-1484.37,124976},
+    {1,1,-14528.5,43147.5},
   },
   // deep = 3
   {
-    {0,-17347.1,145539},
-    {1,-4302.94,74351.3},
-    {2,-18831.5,42972.2},
+    {0,1,17347.1,145539},
+    {1,1,4302.94,74351.3},
+    {2,1,18831.5,42972.2},
   },
   // deep = 4
   {
-    {0,3953.91,150408},
-    {1,16998.1,86200.4},
-    {2,2469.53,57671.6},
-    {3,21301,28336.5},
+    {0,1,-3953.91,150408},
+    {1,1,-16998.1,86200.4},
+    {2,1,-2469.53,57671.6},
+    {3,1,-21301,28336.5},
   },
   // deep = 5
   {
-    {0,-16857.5,154353},
-    {1,-3813.34,99468.7},
-    {2,-18341.9,79531.1},
-    {3,489.602,59355},
-    {4,-20811.4,45969.9},
+    {0,1,16857.5,154353},
+    {1,1,3813.34,99468.7},
+    {2,1,18341.9,79531.1},
+    {3,1,-489.602,59355},
+    {4,1,20811.4,45969.9},
   },
   // deep = 6
   {
-    {0,4104.23,153023},
-    {1,17148.4,98397.1},
-    {2,2619.85,82771.7},
-    {3,21451.3,67424.5},
-    {4,150.32,58871},
-    {5,20961.7,30327.5},
+    {0,1,-4104.23,153023},
+    {1,1,-17148.4,98397.1},
+    {2,1,-2619.85,82771.7},
+    {3,1,-21451.3,67424.5},
+    {4,1,-150.32,58871},
+    {5,1,-20961.7,30327.5},
   },
   // deep = 7
   {
-    {0,-16159.7,156974},
-    {1,-3115.49,103025},
-    {2,-17644,89198.4},
-    {3,1187.45,74958.7},
-    {4,-20113.6,65930.2},
-    {5,697.845,36565.1},
-    {6,-20263.9,20784},
+    {0,1,16159.7,156974},
+    {1,1,3115.49,103025},
+    {2,1,17644,89198.4},
+    {3,1,-1187.45,74958.7},
+    {4,1,20113.6,65930.2},
+    {5,1,-697.845,36565.1},
+    {6,1,20263.9,20784},
   },
   // deep = 8
   {
-    {0,14078.3,157196},
-    {1,27122.5,103692},
-    {2,12593.9,89394.1},
-    {3,31425.4,75101.8},
-    {4,10124.4,66844.7},
-    {5,30935.8,41691},
-    {6,9974.09,20735.5},
-    {7,30238,18101.3},
+    {0,1,-14078.3,157196},
+    {1,1,-27122.5,103692},
+    {2,1,-12593.9,89394.1},
+    {3,1,-31425.4,75101.8},
+    {4,1,-10124.4,66844.7},
+    {5,1,-30935.8,41691},
+    {6,1,-9974.09,20735.5},
+    {7,1,-30238,18101.3},
   },
 },
 // move 6
@@ -403,63 +403,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-13044.2,92074.1},
+    {0,1,13044.2,92074.1},
   },
   // deep = 2
   {
-    {0,1484.37,124976},
-    {1,14528.5,43147.5},
+    {0,1,-1484.37,124976},
+    {1,1,-14528.5,43147.5},
   },
   // deep = 3
   {
-    {0,-17347.1,145539},
-    {1,-4302.94,74351.3},
-    {2,-18831.5,42972.2},
+    {0,1,17347.1,145539},
+    {1,1,4302.94,74351.3},
+    {2,1,18831.5,42972.2},
   },
   // deep = 4
   {
-    {0,3953.91,150408},
-    {1,16998.1,86200.4},
-    {2,2469.53,57671.6},
-    {3,21301,28336.5},
+    {0,1,-3953.91,150408},
+    {1,1,-16998.1,86200.4},
+    {2,1,-2469.53,57671.6},
+    {3,1,-21301,28336.5},
   },
   // deep = 5
   {
-    {0,-16857.5,154353},
-    {1,-3813.34,99468.7},
-    {2,-18341.9,79531.1},
-    {3,489.602,59355},
-    {4,-20811.4,45969.9},
+    {0,1,16857.5,154353},
+    {1,1,3813.34,99468.7},
+    {2,1,18341.9,79531.1},
+    {3,1,-489.602,59355},
+    {4,1,20811.4,45969.9},
   },
   // deep = 6
   {
-    {0,4104.23,153023},
-    {1,17148.4,98397.1},
-    {2,2619.85,82771.7},
-    {3,21451.3,67424.5},
-    {4,150.32,58871},
-    {5,20961.7,30327.5},
+    {0,1,-4104.23,153023},
+    {1,1,-17148.4,98397.1},
+    {2,1,-2619.85,82771.7},
+    {3,1,-21451.3,67424.5},
+    {4,1,-150.32,58871},
+    {5,1,-20961.7,30327.5},
   },
   // deep = 7
   {
-    {0,-16159.7,156974},
-    {1,-3115.49,103025},
-    {2,-17644,89198.4},
-    {3,1187.45,74958.7},
-    {4,-20113.6,65930.2},
-    {5,697.845,36565.1},
-    {6,-20263.9,20784},
+    {0,1,16159.7,156974},
+    {1,1,3115.49,103025},
+    {2,1,17644,89198.4},
+    {3,1,-1187.45,74958.7},
+    {4,1,20113.6,65930.2},
+    {5,1,-697.845,36565.1},
+    {6,1,20263.9,20784},
   },
   // deep = 8
   {
-    {0,14078.3,157196},
-    {1,27122.5,103692},
-    {2,12593.9,89394.1},
-    {3,31425.4,75101.8},
-    {4,10124.4,66844.7},
-    {5,30935.8,41691},
-    {6,9974.09,20735.5},
-    {7,30238,18101.3},
+    {0,1,-14078.3,157196},
+    {1,1,-27122.5,103692},
+    {2,1,-12593.9,89394.1},
+    {3,1,-31425.4,75101.8},
+    {4,1,-10124.4,66844.7},
+    {5,1,-30935.8,41691},
+    {6,1,-9974.09,20735.5},
+    {7,1,-30238,18101.3},
   },
 },
 // move 7
@@ -469,63 +469,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-13044.2,92074.1},
+    {0,1,13044.2,92074.1},
   },
   // deep = 2
   {
-    {0,1484.37,124976},
-    {1,14528.5,43147.5},
+    {0,1,-1484.37,124976},
+    {1,1,-14528.5,43147.5},
   },
   // deep = 3
   {
-    {0,-17347.1,145539},
-    {1,-4302.94,74351.3},
-    {2,-18831.5,42972.2},
+    {0,1,17347.1,145539},
+    {1,1,4302.94,74351.3},
+    {2,1,18831.5,42972.2},
   },
   // deep = 4
   {
-    {0,3953.91,150408},
-    {1,16998.1,86200.4},
-    {2,2469.53,57671.6},
-    {3,21301,28336.5},
+    {0,1,-3953.91,150408},
+    {1,1,-16998.1,86200.4},
+    {2,1,-2469.53,57671.6},
+    {3,1,-21301,28336.5},
   },
   // deep = 5
   {
-    {0,-16857.5,154353},
-    {1,-3813.34,99468.7},
-    {2,-18341.9,79531.1},
-    {3,489.602,59355},
-    {4,-20811.4,45969.9},
+    {0,1,16857.5,154353},
+    {1,1,3813.34,99468.7},
+    {2,1,18341.9,79531.1},
+    {3,1,-489.602,59355},
+    {4,1,20811.4,45969.9},
   },
   // deep = 6
   {
-    {0,4104.23,153023},
-    {1,17148.4,98397.1},
-    {2,2619.85,82771.7},
-    {3,21451.3,67424.5},
-    {4,150.32,58871},
-    {5,20961.7,30327.5},
+    {0,1,-4104.23,153023},
+    {1,1,-17148.4,98397.1},
+    {2,1,-2619.85,82771.7},
+    {3,1,-21451.3,67424.5},
+    {4,1,-150.32,58871},
+    {5,1,-20961.7,30327.5},
   },
   // deep = 7
   {
-    {0,-16159.7,156974},
-    {1,-3115.49,103025},
-    {2,-17644,89198.4},
-    {3,1187.45,74958.7},
-    {4,-20113.6,65930.2},
-    {5,697.845,36565.1},
-    {6,-20263.9,20784},
+    {0,1,16159.7,156974},
+    {1,1,3115.49,103025},
+    {2,1,17644,89198.4},
+    {3,1,-1187.45,74958.7},
+    {4,1,20113.6,65930.2},
+    {5,1,-697.845,36565.1},
+    {6,1,20263.9,20784},
   },
   // deep = 8
   {
-    {0,14078.3,157196},
-    {1,27122.5,103692},
-    {2,12593.9,89394.1},
-    {3,31425.4,75101.8},
-    {4,10124.4,66844.7},
-    {5,30935.8,41691},
-    {6,9974.09,20735.5},
-    {7,30238,18101.3},
+    {0,1,-14078.3,157196},
+    {1,1,-27122.5,103692},
+    {2,1,-12593.9,89394.1},
+    {3,1,-31425.4,75101.8},
+    {4,1,-10124.4,66844.7},
+    {5,1,-30935.8,41691},
+    {6,1,-9974.09,20735.5},
+    {7,1,-30238,18101.3},
   },
 },
 // move 8
@@ -535,63 +535,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-13044.2,92074.1},
+    {0,1,13044.2,92074.1},
   },
   // deep = 2
   {
-    {0,1484.37,124976},
-    {1,14528.5,43147.5},
+    {0,1,-1484.37,124976},
+    {1,1,-14528.5,43147.5},
   },
   // deep = 3
   {
-    {0,-17347.1,145539},
-    {1,-4302.94,74351.3},
-    {2,-18831.5,42972.2},
+    {0,1,17347.1,145539},
+    {1,1,4302.94,74351.3},
+    {2,1,18831.5,42972.2},
   },
   // deep = 4
   {
-    {0,3953.91,150408},
-    {1,16998.1,86200.4},
-    {2,2469.53,57671.6},
-    {3,21301,28336.5},
+    {0,1,-3953.91,150408},
+    {1,1,-16998.1,86200.4},
+    {2,1,-2469.53,57671.6},
+    {3,1,-21301,28336.5},
   },
   // deep = 5
   {
-    {0,-16857.5,154353},
-    {1,-3813.34,99468.7},
-    {2,-18341.9,79531.1},
-    {3,489.602,59355},
-    {4,-20811.4,45969.9},
+    {0,1,16857.5,154353},
+    {1,1,3813.34,99468.7},
+    {2,1,18341.9,79531.1},
+    {3,1,-489.602,59355},
+    {4,1,20811.4,45969.9},
   },
   // deep = 6
   {
-    {0,4104.23,153023},
-    {1,17148.4,98397.1},
-    {2,2619.85,82771.7},
-    {3,21451.3,67424.5},
-    {4,150.32,58871},
-    {5,20961.7,30327.5},
+    {0,1,-4104.23,153023},
+    {1,1,-17148.4,98397.1},
+    {2,1,-2619.85,82771.7},
+    {3,1,-21451.3,67424.5},
+    {4,1,-150.32,58871},
+    {5,1,-20961.7,30327.5},
   },
   // deep = 7
   {
-    {0,-16159.7,156974},
-    {1,-3115.49,103025},
-    {2,-17644,89198.4},
-    {3,1187.45,74958.7},
-    {4,-20113.6,65930.2},
-    {5,697.845,36565.1},
-    {6,-20263.9,20784},
+    {0,1,16159.7,156974},
+    {1,1,3115.49,103025},
+    {2,1,17644,89198.4},
+    {3,1,-1187.45,74958.7},
+    {4,1,20113.6,65930.2},
+    {5,1,-697.845,36565.1},
+    {6,1,20263.9,20784},
   },
   // deep = 8
   {
-    {0,14078.3,157196},
-    {1,27122.5,103692},
-    {2,12593.9,89394.1},
-    {3,31425.4,75101.8},
-    {4,10124.4,66844.7},
-    {5,30935.8,41691},
-    {6,9974.09,20735.5},
-    {7,30238,18101.3},
+    {0,1,-14078.3,157196},
+    {1,1,-27122.5,103692},
+    {2,1,-12593.9,89394.1},
+    {3,1,-31425.4,75101.8},
+    {4,1,-10124.4,66844.7},
+    {5,1,-30935.8,41691},
+    {6,1,-9974.09,20735.5},
+    {7,1,-30238,18101.3},
   },
 },
 // move 9
@@ -601,63 +601,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-14381.6,50703.4},
+    {0,1,14381.6,50703.4},
   },
   // deep = 2
   {
-    {0,6258.41,81509.5},
-    {1,20640.1,47319},
+    {0,1,-6258.41,81509.5},
+    {1,1,-20640.1,47319},
   },
   // deep = 3
   {
-    {0,-14962.3,98194.3},
-    {1,-580.623,63467},
-    {2,-21220.7,32779.7},
+    {0,1,14962.3,98194.3},
+    {1,1,580.623,63467},
+    {2,1,21220.7,32779.7},
   },
   // deep = 4
   {
-    {0,8334.33,107680},
-    {1,22716,85431.3},
-    {2,2075.92,58234.1},
-    {3,23296.6,49399},
+    {0,1,-8334.33,107680},
+    {1,1,-22716,85431.3},
+    {2,1,-2075.92,58234.1},
+    {3,1,-23296.6,49399},
   },
   // deep = 5
   {
-    {0,-11459.4,104032},
-    {1,2922.29,86974},
-    {2,-17717.8,70633.2},
-    {3,3502.91,65386.2},
-    {4,-19793.7,39228.7},
+    {0,1,11459.4,104032},
+    {1,1,-2922.29,86974},
+    {2,1,17717.8,70633.2},
+    {3,1,-3502.91,65386.2},
+    {4,1,19793.7,39228.7},
   },
   // deep = 6
   {
-    {0,11555.8,107758},
-    {1,25937.4,96282.9},
-    {2,5297.39,78681.4},
-    {3,26518.1,76354.3},
-    {4,3221.47,45085.5},
-    {5,23015.2,28288.3},
+    {0,1,-11555.8,107758},
+    {1,1,-25937.4,96282.9},
+    {2,1,-5297.39,78681.4},
+    {3,1,-26518.1,76354.3},
+    {4,1,-3221.47,45085.5},
+    {5,1,-23015.2,28288.3},
   },
   // deep = 7
   {
-    {0,-18534.9,108649},
-    {1,-4153.24,95957},
-    {2,-24793.3,79880.7},
-    {3,-3572.62,77114.2},
-    {4,-26869.2,49141.4},
-    {5,-7075.53,25742.9},
-    {6,-30090.7,19109.3},
+    {0,1,18534.9,108649},
+    {1,1,4153.24,95957},
+    {2,1,24793.3,79880.7},
+    {3,1,3572.62,77114.2},
+    {4,1,26869.2,49141.4},
+    {5,1,7075.53,25742.9},
+    {6,1,30090.7,19109.3},
   },
   // deep = 8
   {
-    {0,3766.13,113896},
-    {1,18147.8,103099},
-    {2,-2492.28,86160},
-    {3,18728.4,84211.9},
-    {4,-4568.2,57374.7},
-    {5,15225.5,46804.3},
-    {6,-7789.67,31463.9},
-    {7,22301,26133.3},
+    {0,1,-3766.13,113896},
+    {1,1,-18147.8,103099},
+    {2,1,2492.28,86160},
+    {3,1,-18728.4,84211.9},
+    {4,1,4568.2,57374.7},
+    {5,1,-15225.5,46804.3},
+    {6,1,7789.67,31463.9},
+    {7,1,-22301,26133.3},
   },
 },
 // move 10
@@ -667,63 +667,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-22105.3,54773.7},
+    {0,1,22105.3,54773.7},
   },
   // deep = 2
   {
-    {0,1877.39,68854.8},
-    {1,23982.7,38444.4},
+    {0,1,-1877.39,68854.8},
+    {1,1,-23982.7,38444.4},
   },
   // deep = 3
   {
-    {0,-20617.6,95076.5},
-    {1,1487.66,65676.3},
-    {2,-22495,56150.3},
+    {0,1,20617.6,95076.5},
+    {1,1,-1487.66,65676.3},
+    {2,1,22495,56150.3},
   },
   // deep = 4
   {
-    {0,4215.7,93909.7},
-    {1,26321,77763.7},
-    {2,2338.31,67693.1},
-    {3,24833.3,48996.1},
+    {0,1,-4215.7,93909.7},
+    {1,1,-26321,77763.7},
+    {2,1,-2338.31,67693.1},
+    {3,1,-24833.3,48996.1},
   },
   // deep = 5
   {
-    {0,-17524.1,98608.4},
-    {1,4581.18,83199.9},
-    {2,-19401.5,80293.8},
-    {3,3093.52,52351.1},
-    {4,-21739.8,32773.6},
+    {0,1,17524.1,98608.4},
+    {1,1,-4581.18,83199.9},
+    {2,1,19401.5,80293.8},
+    {3,1,-3093.52,52351.1},
+    {4,1,21739.8,32773.6},
   },
   // deep = 6
   {
-    {0,14667.3,97320.2},
-    {1,36772.6,87664.4},
-    {2,12789.9,82765.8},
-    {3,35284.9,66746.7},
-    {4,10451.6,33339.2},
-    {5,32191.4,30226.9},
+    {0,1,-14667.3,97320.2},
+    {1,1,-36772.6,87664.4},
+    {2,1,-12789.9,82765.8},
+    {3,1,-35284.9,66746.7},
+    {4,1,-10451.6,33339.2},
+    {5,1,-32191.4,30226.9},
   },
   // deep = 7
   {
-    {0,-8212.76,105581},
-    {1,13892.5,94240.7},
-    {2,-10090.2,92233.3},
-    {3,12404.9,72465.1},
-    {4,-12428.5,55698.8},
-    {5,9311.33,38411.5},
-    {6,-22880.1,31847.8},
+    {0,1,8212.76,105581},
+    {1,1,-13892.5,94240.7},
+    {2,1,10090.2,92233.3},
+    {3,1,-12404.9,72465.1},
+    {4,1,12428.5,55698.8},
+    {5,1,-9311.33,38411.5},
+    {6,1,22880.1,31847.8},
   },
   // deep = 8
   {
-    {0,25042.6,101152},
-    {1,47147.9,93690.7},
-    {2,23165.2,90632.7},
-    {3,45660.2,77204},
-    {4,20826.9,53177.9},
-    {5,42566.7,45787},
-    {6,10375.3,30891.7},
-    {7,33255.4,28739.8},
+    {0,1,-25042.6,101152},
+    {1,1,-47147.9,93690.7},
+    {2,1,-23165.2,90632.7},
+    {3,1,-45660.2,77204},
+    {4,1,-20826.9,53177.9},
+    {5,1,-42566.7,45787},
+    {6,1,-10375.3,30891.7},
+    {7,1,-33255.4,28739.8},
   },
 },
 // move 11
@@ -733,63 +733,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-22252.9,55034.6},
+    {0,1,22252.9,55034.6},
   },
   // deep = 2
   {
-    {0,9443.92,78066},
-    {1,31696.9,62275.6},
+    {0,1,-9443.92,78066},
+    {1,1,-31696.9,62275.6},
   },
   // deep = 3
   {
-    {0,-14200.4,92541.2},
-    {1,8052.53,76553.7},
-    {2,-23644.3,52352.5},
+    {0,1,14200.4,92541.2},
+    {1,1,-8052.53,76553.7},
+    {2,1,23644.3,52352.5},
   },
   // deep = 4
   {
-    {0,15032.1,90563.3},
-    {1,37285,87449.3},
-    {2,5588.17,50272.4},
-    {3,29232.5,49771.2},
+    {0,1,-15032.1,90563.3},
+    {1,1,-37285,87449.3},
+    {2,1,-5588.17,50272.4},
+    {3,1,-29232.5,49771.2},
   },
   // deep = 5
   {
-    {0,-18365.8,94040.5},
-    {1,3887.1,89545.1},
-    {2,-27809.8,68474.1},
-    {3,-4165.43,52022.7},
-    {4,-33397.9,38290.9},
+    {0,1,18365.8,94040.5},
+    {1,1,-3887.1,89545.1},
+    {2,1,27809.8,68474.1},
+    {3,1,4165.43,52022.7},
+    {4,1,33397.9,38290.9},
   },
   // deep = 6
   {
-    {0,8371.01,99407.8},
-    {1,30624,101741},
-    {2,-1072.9,75595.5},
-    {3,22571.4,80012.9},
-    {4,-6661.07,41508},
-    {5,26736.9,42223},
+    {0,1,-8371.01,99407.8},
+    {1,1,-30624,101741},
+    {2,1,1072.9,75595.5},
+    {3,1,-22571.4,80012.9},
+    {4,1,6661.07,41508},
+    {5,1,-26736.9,42223},
   },
   // deep = 7
   {
-    {0,-25723.7,97314},
-    {1,-3470.75,100326},
-    {2,-35167.6,80642.3},
-    {3,-11523.3,76397.3},
-    {4,-40755.8,50577.1},
-    {5,-7357.85,38812.8},
-    {6,-34094.7,32166.9},
+    {0,1,25723.7,97314},
+    {1,1,3470.75,100326},
+    {2,1,35167.6,80642.3},
+    {3,1,11523.3,76397.3},
+    {4,1,40755.8,50577.1},
+    {5,1,7357.85,38812.8},
+    {6,1,34094.7,32166.9},
   },
   // deep = 8
   {
-    {0,4815.91,108244},
-    {1,27068.9,114159},
-    {2,-4628.01,91944.5},
-    {3,19016.3,93454.6},
-    {4,-10216.2,64966.1},
-    {5,23181.8,61846.1},
-    {6,-3555.1,46036.8},
-    {7,30539.6,39123},
+    {0,1,-4815.91,108244},
+    {1,1,-27068.9,114159},
+    {2,1,4628.01,91944.5},
+    {3,1,-19016.3,93454.6},
+    {4,1,10216.2,64966.1},
+    {5,1,-23181.8,61846.1},
+    {6,1,3555.1,46036.8},
+    {7,1,-30539.6,39123},
   },
 },
 // move 12
@@ -799,63 +799,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-31238.8,68944.1},
+    {0,1,31238.8,68944.1},
   },
   // deep = 2
   {
-    {0,-2038.87,77541.1},
-    {1,29200,62900.6},
+    {0,1,2038.87,77541.1},
+    {1,1,-29200,62900.6},
   },
   // deep = 3
   {
-    {0,-30332.6,94277.3},
-    {1,906.258,69101.2},
-    {2,-28293.7,50356.3},
+    {0,1,30332.6,94277.3},
+    {1,1,-906.258,69101.2},
+    {2,1,28293.7,50356.3},
   },
   // deep = 4
   {
-    {0,6159.66,97785.2},
-    {1,37398.5,90953.6},
-    {2,8198.52,49056.7},
-    {3,36492.2,49097.8},
+    {0,1,-6159.66,97785.2},
+    {1,1,-37398.5,90953.6},
+    {2,1,-8198.52,49056.7},
+    {3,1,-36492.2,49097.8},
   },
   // deep = 5
   {
-    {0,-21300.4,108230},
-    {1,9938.45,96393.4},
-    {2,-19261.5,78513.5},
-    {3,9032.2,57506.6},
-    {4,-27460,45802.8},
+    {0,1,21300.4,108230},
+    {1,1,-9938.45,96393.4},
+    {2,1,19261.5,78513.5},
+    {3,1,-9032.2,57506.6},
+    {4,1,27460,45802.8},
   },
   // deep = 6
   {
-    {0,16802.8,103782},
-    {1,48041.6,101010},
-    {2,18841.6,73573.2},
-    {3,47135.3,64002},
-    {4,10643.1,40692.5},
-    {5,38103.1,39012},
+    {0,1,-16802.8,103782},
+    {1,1,-48041.6,101010},
+    {2,1,-18841.6,73573.2},
+    {3,1,-47135.3,64002},
+    {4,1,-10643.1,40692.5},
+    {5,1,-38103.1,39012},
   },
   // deep = 7
   {
-    {0,-13097.2,114800},
-    {1,18141.6,108523},
-    {2,-11058.4,89011.1},
-    {3,17235.4,69260.4},
-    {4,-19256.9,58937.1},
-    {5,8203.17,41117.7},
-    {6,-29900,39668.6},
+    {0,1,13097.2,114800},
+    {1,1,-18141.6,108523},
+    {2,1,11058.4,89011.1},
+    {3,1,-17235.4,69260.4},
+    {4,1,19256.9,58937.1},
+    {5,1,-8203.17,41117.7},
+    {6,1,29900,39668.6},
   },
   // deep = 8
   {
-    {0,16019.2,105329},
-    {1,47258,104720},
-    {2,18058.1,81857.6},
-    {3,46351.8,72941.2},
-    {4,9859.53,56184.5},
-    {5,37319.6,49777},
-    {6,-783.576,31792.8},
-    {7,29116.4,36983.4},
+    {0,1,-16019.2,105329},
+    {1,1,-47258,104720},
+    {2,1,-18058.1,81857.6},
+    {3,1,-46351.8,72941.2},
+    {4,1,-9859.53,56184.5},
+    {5,1,-37319.6,49777},
+    {6,1,783.576,31792.8},
+    {7,1,-29116.4,36983.4},
   },
 },
 // move 13
@@ -865,63 +865,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-24677.8,64162.7},
+    {0,1,24677.8,64162.7},
   },
   // deep = 2
   {
-    {0,13284.4,70661},
-    {1,37962.3,63800.5},
+    {0,1,-13284.4,70661},
+    {1,1,-37962.3,63800.5},
   },
   // deep = 3
   {
-    {0,-22175,80505.6},
-    {1,2502.87,63972.5},
-    {2,-35459.4,54748.5},
+    {0,1,22175,80505.6},
+    {1,1,-2502.87,63972.5},
+    {2,1,35459.4,54748.5},
   },
   // deep = 4
   {
-    {0,12736.2,92880.7},
-    {1,37414.1,98747.4},
-    {2,-548.186,59647.3},
-    {3,34911.2,56933.1},
+    {0,1,-12736.2,92880.7},
+    {1,1,-37414.1,98747.4},
+    {2,1,548.186,59647.3},
+    {3,1,-34911.2,56933.1},
   },
   // deep = 5
   {
-    {0,-26827.1,86929.5},
-    {1,-2149.29,91085.5},
-    {2,-40111.5,66701.5},
-    {3,-4652.16,50563.2},
-    {4,-39563.4,44965.2},
+    {0,1,26827.1,86929.5},
+    {1,1,2149.29,91085.5},
+    {2,1,40111.5,66701.5},
+    {3,1,4652.16,50563.2},
+    {4,1,39563.4,44965.2},
   },
   // deep = 6
   {
-    {0,7077.81,102980},
-    {1,31755.7,117131},
-    {2,-6206.61,78616.1},
-    {3,29252.8,80618.7},
-    {4,-5658.42,43544},
-    {5,33904.9,47545},
+    {0,1,-7077.81,102980},
+    {1,1,-31755.7,117131},
+    {2,1,6206.61,78616.1},
+    {3,1,-29252.8,80618.7},
+    {4,1,5658.42,43544},
+    {5,1,-33904.9,47545},
   },
   // deep = 7
   {
-    {0,-20156.1,94661.9},
-    {1,4521.77,108803},
-    {2,-33440.5,78900.8},
-    {3,2018.9,75196.1},
-    {4,-32892.3,52436.9},
-    {5,6671.06,44583.5},
-    {6,-27233.9,38225.8},
+    {0,1,20156.1,94661.9},
+    {1,1,-4521.77,108803},
+    {2,1,33440.5,78900.8},
+    {3,1,-2018.9,75196.1},
+    {4,1,32892.3,52436.9},
+    {5,1,-6671.06,44583.5},
+    {6,1,27233.9,38225.8},
   },
   // deep = 8
   {
-    {0,23032.6,109130},
-    {1,47710.4,126067},
-    {2,9748.14,90358.7},
-    {3,45207.5,95965.4},
-    {4,10296.3,64018.5},
-    {5,49859.7,67832.5},
-    {6,15954.7,43784},
-    {7,43188.6,43256.8},
+    {0,1,-23032.6,109130},
+    {1,1,-47710.4,126067},
+    {2,1,-9748.14,90358.7},
+    {3,1,-45207.5,95965.4},
+    {4,1,-10296.3,64018.5},
+    {5,1,-49859.7,67832.5},
+    {6,1,-15954.7,43784},
+    {7,1,-43188.6,43256.8},
   },
 },
 // move 14
@@ -931,63 +931,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-37473.7,69742.4},
+    {0,1,37473.7,69742.4},
   },
   // deep = 2
   {
-    {0,7665.94,68211.6},
-    {1,45139.6,72732},
+    {0,1,-7665.94,68211.6},
+    {1,1,-45139.6,72732},
   },
   // deep = 3
   {
-    {0,-24173.6,89949.7},
-    {1,13300.1,73168},
-    {2,-31839.6,56217},
+    {0,1,24173.6,89949.7},
+    {1,1,-13300.1,73168},
+    {2,1,31839.6,56217},
   },
   // deep = 4
   {
-    {0,14678.6,87869.8},
-    {1,52152.3,90907.9},
-    {2,7012.65,57796.9},
-    {3,38852.2,45937.8},
+    {0,1,-14678.6,87869.8},
+    {1,1,-52152.3,90907.9},
+    {2,1,-7012.65,57796.9},
+    {3,1,-38852.2,45937.8},
   },
   // deep = 5
   {
-    {0,-16293.4,98445.4},
-    {1,21180.3,92696.3},
-    {2,-23959.3,81646},
-    {3,7880.23,47783.6},
-    {4,-30972,43035.3},
+    {0,1,16293.4,98445.4},
+    {1,1,-21180.3,92696.3},
+    {2,1,23959.3,81646},
+    {3,1,-7880.23,47783.6},
+    {4,1,30972,43035.3},
   },
   // deep = 6
   {
-    {0,11337.1,96655},
-    {1,48810.8,102269},
-    {2,3671.19,77352.1},
-    {3,35510.7,59376.7},
-    {4,-3341.47,40112.2},
-    {5,27630.5,37580.4},
+    {0,1,-11337.1,96655},
+    {1,1,-48810.8,102269},
+    {2,1,-3671.19,77352.1},
+    {3,1,-35510.7,59376.7},
+    {4,1,3341.47,40112.2},
+    {5,1,-27630.5,37580.4},
   },
   // deep = 7
   {
-    {0,-27164.1,105295},
-    {1,10309.5,107779},
-    {2,-34830.1,95365},
-    {3,-2990.53,73382.5},
-    {4,-41842.7,60320.2},
-    {5,-10870.8,49763.1},
-    {6,-38501.3,40013.7},
+    {0,1,27164.1,105295},
+    {1,1,-10309.5,107779},
+    {2,1,34830.1,95365},
+    {3,1,2990.53,73382.5},
+    {4,1,41842.7,60320.2},
+    {5,1,10870.8,49763.1},
+    {6,1,38501.3,40013.7},
   },
   // deep = 8
   {
-    {0,7261.76,101826},
-    {1,44735.4,115467},
-    {2,-404.171,93514.4},
-    {3,31435.4,85100.8},
-    {4,-7416.82,64204.7},
-    {5,23555.2,66787.1},
-    {6,-4075.36,46533.1},
-    {7,34425.9,46755.2},
+    {0,1,-7261.76,101826},
+    {1,1,-44735.4,115467},
+    {2,1,404.171,93514.4},
+    {3,1,-31435.4,85100.8},
+    {4,1,7416.82,64204.7},
+    {5,1,-23555.2,66787.1},
+    {6,1,4075.36,46533.1},
+    {7,1,-34425.9,46755.2},
   },
 },
 // move 15
@@ -997,63 +997,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-43181.7,77487.9},
+    {0,1,43181.7,77487.9},
   },
   // deep = 2
   {
-    {0,1583.02,78784.9},
-    {1,44764.7,85671.7},
+    {0,1,-1583.02,78784.9},
+    {1,1,-44764.7,85671.7},
   },
   // deep = 3
   {
-    {0,-35333.2,92589.2},
-    {1,7848.47,88323.6},
-    {2,-36916.2,57502.4},
+    {0,1,35333.2,92589.2},
+    {1,1,-7848.47,88323.6},
+    {2,1,36916.2,57502.4},
   },
   // deep = 4
   {
-    {0,1128.3,96661.1},
-    {1,44310,114689},
-    {2,-454.721,57873},
-    {3,36461.5,61047.1},
+    {0,1,-1128.3,96661.1},
+    {1,1,-44310,114689},
+    {2,1,454.721,57873},
+    {3,1,-36461.5,61047.1},
   },
   // deep = 5
   {
-    {0,-24469.4,94220.4},
-    {1,18712.3,109461},
-    {2,-26052.4,69040.2},
-    {3,10863.8,59237.8},
-    {4,-25597.7,41097.9},
+    {0,1,24469.4,94220.4},
+    {1,1,-18712.3,109461},
+    {2,1,26052.4,69040.2},
+    {3,1,-10863.8,59237.8},
+    {4,1,25597.7,41097.9},
   },
   // deep = 6
   {
-    {0,15010,105089},
-    {1,58191.6,127926},
-    {2,13427,81312.7},
-    {3,50343.2,77292.8},
-    {4,13881.7,51924.1},
-    {5,39479.4,40807.2},
+    {0,1,-15010,105089},
+    {1,1,-58191.6,127926},
+    {2,1,-13427,81312.7},
+    {3,1,-50343.2,77292.8},
+    {4,1,-13881.7,51924.1},
+    {5,1,-39479.4,40807.2},
   },
   // deep = 7
   {
-    {0,-14750.6,104944},
-    {1,28431,123952},
-    {2,-16333.6,87201.7},
-    {3,20582.6,76935.2},
-    {4,-15878.9,61387.3},
-    {5,9718.79,42004.2},
-    {6,-29760.6,42297.9},
+    {0,1,14750.6,104944},
+    {1,1,-28431,123952},
+    {2,1,16333.6,87201.7},
+    {3,1,-20582.6,76935.2},
+    {4,1,15878.9,61387.3},
+    {5,1,-9718.79,42004.2},
+    {6,1,29760.6,42297.9},
   },
   // deep = 8
   {
-    {0,33144.2,107604},
-    {1,76325.9,132968},
-    {2,31561.2,89644.1},
-    {3,68477.4,87929.7},
-    {4,32015.9,67859.5},
-    {5,57613.7,57191.3},
-    {6,18134.3,35252},
-    {7,47894.9,41849.9},
+    {0,1,-33144.2,107604},
+    {1,1,-76325.9,132968},
+    {2,1,-31561.2,89644.1},
+    {3,1,-68477.4,87929.7},
+    {4,1,-32015.9,67859.5},
+    {5,1,-57613.7,57191.3},
+    {6,1,-18134.3,35252},
+    {7,1,-47894.9,41849.9},
   },
 },
 // move 16
@@ -1063,63 +1063,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-40713.6,80556.7},
+    {0,1,40713.6,80556.7},
   },
   // deep = 2
   {
-    {0,4721.86,77049.9},
-    {1,45435.4,71326.1},
+    {0,1,-4721.86,77049.9},
+    {1,1,-45435.4,71326.1},
   },
   // deep = 3
   {
-    {0,-28882.1,95418.2},
-    {1,11831.5,72337.9},
-    {2,-33604,60494.5},
+    {0,1,28882.1,95418.2},
+    {1,1,-11831.5,72337.9},
+    {2,1,33604,60494.5},
   },
   // deep = 4
   {
-    {0,2874.56,85513.7},
-    {1,43588.1,88003.8},
-    {2,-1847.31,56928.2},
-    {3,31756.7,51720.1},
+    {0,1,-2874.56,85513.7},
+    {1,1,-43588.1,88003.8},
+    {2,1,1847.31,56928.2},
+    {3,1,-31756.7,51720.1},
   },
   // deep = 5
   {
-    {0,-35195.2,109869},
-    {1,5518.39,107481},
-    {2,-39917.1,87314.5},
-    {3,-6313.1,68164.6},
-    {4,-38069.7,49787.5},
+    {0,1,35195.2,109869},
+    {1,1,-5518.39,107481},
+    {2,1,39917.1,87314.5},
+    {3,1,6313.1,68164.6},
+    {4,1,38069.7,49787.5},
   },
   // deep = 6
   {
-    {0,-714.93,101739},
-    {1,39998.7,114784},
-    {2,-5436.79,83071},
-    {3,28167.2,81229.1},
-    {4,-3589.49,49825.5},
-    {5,34480.3,49261.3},
+    {0,1,714.93,101739},
+    {1,1,-39998.7,114784},
+    {2,1,5436.79,83071},
+    {3,1,-28167.2,81229.1},
+    {4,1,3589.49,49825.5},
+    {5,1,-34480.3,49261.3},
   },
   // deep = 7
   {
-    {0,-45987.7,110796},
-    {1,-5274.1,118766},
-    {2,-50709.5,95832.9},
-    {3,-17105.6,86569.5},
-    {4,-48862.2,59571.1},
-    {5,-10792.5,38385.4},
-    {6,-45272.7,37216.2},
+    {0,1,45987.7,110796},
+    {1,1,5274.1,118766},
+    {2,1,50709.5,95832.9},
+    {3,1,17105.6,86569.5},
+    {4,1,48862.2,59571.1},
+    {5,1,10792.5,38385.4},
+    {6,1,45272.7,37216.2},
   },
   // deep = 8
   {
-    {0,-12441.7,100360},
-    {1,28271.8,119383},
-    {2,-17163.6,90469.6},
-    {3,16440.4,91584.6},
-    {4,-15316.3,55501},
-    {5,22753.5,60533},
-    {6,-11726.8,28409.7},
-    {7,33545.9,43499.6},
+    {0,1,12441.7,100360},
+    {1,1,-28271.8,119383},
+    {2,1,17163.6,90469.6},
+    {3,1,-16440.4,91584.6},
+    {4,1,15316.3,55501},
+    {5,1,-22753.5,60533},
+    {6,1,11726.8,28409.7},
+    {7,1,-33545.9,43499.6},
   },
 },
 // move 17
@@ -1129,63 +1129,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-43939.3,87475.5},
+    {0,1,43939.3,87475.5},
   },
   // deep = 2
   {
-    {0,206.881,65849.2},
-    {1,44146.2,93173.1},
+    {0,1,-206.881,65849.2},
+    {1,1,-44146.2,93173.1},
   },
   // deep = 3
   {
-    {0,-26255.3,85318.7},
-    {1,17684,85744.5},
-    {2,-26462.2,69739.7},
+    {0,1,26255.3,85318.7},
+    {1,1,-17684,85744.5},
+    {2,1,26462.2,69739.7},
   },
   // deep = 4
   {
-    {0,17589.9,85543},
-    {1,61529.3,118554},
-    {2,17383,65298.1},
-    {3,43845.3,72956.6},
+    {0,1,-17589.9,85543},
+    {1,1,-61529.3,118554},
+    {2,1,-17383,65298.1},
+    {3,1,-43845.3,72956.6},
   },
   // deep = 5
   {
-    {0,-11816.2,99651.9},
-    {1,32123.1,115529},
-    {2,-12023.1,92252.7},
-    {3,14439.1,70836.6},
-    {4,-29406.2,60821.6},
+    {0,1,11816.2,99651.9},
+    {1,1,-32123.1,115529},
+    {2,1,12023.1,92252.7},
+    {3,1,-14439.1,70836.6},
+    {4,1,29406.2,60821.6},
   },
   // deep = 6
   {
-    {0,35350.7,101829},
-    {1,79290,137801},
-    {2,35143.8,89934.4},
-    {3,61606,95231.8},
-    {4,17760.8,44869.4},
-    {5,47166.9,56311.4},
+    {0,1,-35350.7,101829},
+    {1,1,-79290,137801},
+    {2,1,-35143.8,89934.4},
+    {3,1,-61606,95231.8},
+    {4,1,-17760.8,44869.4},
+    {5,1,-47166.9,56311.4},
   },
   // deep = 7
   {
-    {0,9095.72,102550},
-    {1,53035,123273},
-    {2,8888.84,95714.2},
-    {3,35351.1,78722},
-    {4,-8494.21,62405.8},
-    {5,20912,25802.5},
-    {6,-26255,52400.6},
+    {0,1,-9095.72,102550},
+    {1,1,-53035,123273},
+    {2,1,-8888.84,95714.2},
+    {3,1,-35351.1,78722},
+    {4,1,8494.21,62405.8},
+    {5,1,-20912,25802.5},
+    {6,1,26255,52400.6},
   },
   // deep = 8
   {
-    {0,54871.2,106625},
-    {1,98810.5,144053},
-    {2,54664.3,97311.9},
-    {3,81126.5,105473},
-    {4,37281.3,56444.7},
-    {5,66687.4,64598.4},
-    {6,19520.5,30699.7},
-    {7,45775.5,56282},
+    {0,1,-54871.2,106625},
+    {1,1,-98810.5,144053},
+    {2,1,-54664.3,97311.9},
+    {3,1,-81126.5,105473},
+    {4,1,-37281.3,56444.7},
+    {5,1,-66687.4,64598.4},
+    {6,1,-19520.5,30699.7},
+    {7,1,-45775.5,56282},
   },
 },
 // move 18
@@ -1195,63 +1195,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-43179.4,96913.5},
+    {0,1,43179.4,96913.5},
   },
   // deep = 2
   {
-    {0,-7787.61,94147.5},
-    {1,35391.8,93195.2},
+    {0,1,7787.61,94147.5},
+    {1,1,-35391.8,93195.2},
   },
   // deep = 3
   {
-    {0,-45433.1,112375},
-    {1,-2253.75,89797.1},
-    {2,-37645.5,77709.7},
+    {0,1,45433.1,112375},
+    {1,1,2253.75,89797.1},
+    {2,1,37645.5,77709.7},
   },
   // deep = 4
   {
-    {0,-11298.3,107948},
-    {1,31881.1,117597},
-    {2,-3510.66,70610.3},
-    {3,34134.9,69091.2},
+    {0,1,11298.3,107948},
+    {1,1,-31881.1,117597},
+    {2,1,3510.66,70610.3},
+    {3,1,-34134.9,69091.2},
   },
   // deep = 5
   {
-    {0,-53080,118438},
-    {1,-9900.64,118246},
-    {2,-45292.4,105275},
-    {3,-7646.89,66251},
-    {4,-41781.7,64043.6},
+    {0,1,53080,118438},
+    {1,1,9900.64,118246},
+    {2,1,45292.4,105275},
+    {3,1,7646.89,66251},
+    {4,1,41781.7,64043.6},
   },
   // deep = 6
   {
-    {0,-24124.3,108804},
-    {1,19055.1,129629},
-    {2,-16336.7,96233.7},
-    {3,21308.8,86775},
-    {4,-12826,50039.3},
-    {5,28955.7,55346.7},
+    {0,1,24124.3,108804},
+    {1,1,-19055.1,129629},
+    {2,1,16336.7,96233.7},
+    {3,1,-21308.8,86775},
+    {4,1,12826,50039.3},
+    {5,1,-28955.7,55346.7},
   },
   // deep = 7
   {
-    {0,-64600.3,117655},
-    {1,-21420.9,126121},
-    {2,-56812.7,110763},
-    {3,-19167.2,79099.4},
-    {4,-53302,72219.1},
-    {5,-11520.3,38824.9},
-    {6,-40476,51660.1},
+    {0,1,64600.3,117655},
+    {1,1,21420.9,126121},
+    {2,1,56812.7,110763},
+    {3,1,19167.2,79099.4},
+    {4,1,53302,72219.1},
+    {5,1,11520.3,38824.9},
+    {6,1,40476,51660.1},
   },
   // deep = 8
   {
-    {0,-15793.3,111321},
-    {1,27386.1,136528},
-    {2,-8005.66,104735},
-    {3,29639.9,95924.9},
-    {4,-4495,63462},
-    {5,37286.7,67489.2},
-    {6,8331.03,37871.3},
-    {7,48807,51945.9},
+    {0,1,15793.3,111321},
+    {1,1,-27386.1,136528},
+    {2,1,8005.66,104735},
+    {3,1,-29639.9,95924.9},
+    {4,1,4495,63462},
+    {5,1,-37286.7,67489.2},
+    {6,1,-8331.03,37871.3},
+    {7,1,-48807,51945.9},
   },
 },
 // move 19
@@ -1261,63 +1261,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-39298.1,99138.8},
+    {0,1,39298.1,99138.8},
   },
   // deep = 2
   {
-    {0,19232.9,91272.2},
-    {1,58531,106424},
+    {0,1,-19232.9,91272.2},
+    {1,1,-58531,106424},
   },
   // deep = 3
   {
-    {0,-10937.7,121644},
-    {1,28360.4,107449},
-    {2,-30170.6,72965.4},
+    {0,1,10937.7,121644},
+    {1,1,-28360.4,107449},
+    {2,1,30170.6,72965.4},
   },
   // deep = 4
   {
-    {0,39549.9,120137},
-    {1,78848,137943},
-    {2,20317,65665.1},
-    {3,50487.6,71449.7},
+    {0,1,-39549.9,120137},
+    {1,1,-78848,137943},
+    {2,1,-20317,65665.1},
+    {3,1,-50487.6,71449.7},
   },
   // deep = 5
   {
-    {0,15566.5,125320},
-    {1,54864.5,127125},
-    {2,-3666.43,81856.3},
-    {3,26504.2,55643.6},
-    {4,-23983.4,57060.4},
+    {0,1,-15566.5,125320},
+    {1,1,-54864.5,127125},
+    {2,1,3666.43,81856.3},
+    {3,1,-26504.2,55643.6},
+    {4,1,23983.4,57060.4},
   },
   // deep = 6
   {
-    {0,60349.8,119078},
-    {1,99647.9,145407},
-    {2,41116.9,78441.1},
-    {3,71287.5,91931.8},
-    {4,20799.9,49457.8},
-    {5,44783.4,60868.6},
+    {0,1,-60349.8,119078},
+    {1,1,-99647.9,145407},
+    {2,1,-41116.9,78441.1},
+    {3,1,-71287.5,91931.8},
+    {4,1,-20799.9,49457.8},
+    {5,1,-44783.4,60868.6},
   },
   // deep = 7
   {
-    {0,17543.4,125976},
-    {1,56841.4,139681},
-    {2,-1689.53,91693.8},
-    {3,28481.1,83692.9},
-    {4,-22006.5,71818.4},
-    {5,1976.9,48833.5},
-    {6,-42806.5,51517.7},
+    {0,1,-17543.4,125976},
+    {1,1,-56841.4,139681},
+    {2,1,1689.53,91693.8},
+    {3,1,-28481.1,83692.9},
+    {4,1,22006.5,71818.4},
+    {5,1,-1976.9,48833.5},
+    {6,1,42806.5,51517.7},
   },
   // deep = 8
   {
-    {0,71319.9,123890},
-    {1,110618,155980},
-    {2,52087,87740.3},
-    {3,82257.6,104421},
-    {4,31770,62955.8},
-    {5,55753.5,73302.7},
-    {6,10970.1,34401.1},
-    {7,53776.6,54978},
+    {0,1,-71319.9,123890},
+    {1,1,-110618,155980},
+    {2,1,-52087,87740.3},
+    {3,1,-82257.6,104421},
+    {4,1,-31770,62955.8},
+    {5,1,-55753.5,73302.7},
+    {6,1,-10970.1,34401.1},
+    {7,1,-53776.6,54978},
   },
 },
 // move 20
@@ -1327,63 +1327,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-63103.2,111198},
+    {0,1,63103.2,111198},
   },
   // deep = 2
   {
-    {0,-14467.9,109659},
-    {1,48635.3,107267},
+    {0,1,14467.9,109659},
+    {1,1,-48635.3,107267},
   },
   // deep = 3
   {
-    {0,-58216.7,121056},
-    {1,4886.56,99561.5},
-    {2,-43748.8,89806.2},
+    {0,1,58216.7,121056},
+    {1,1,-4886.56,99561.5},
+    {2,1,43748.8,89806.2},
   },
   // deep = 4
   {
-    {0,-26102.4,107635},
-    {1,37000.8,120939},
-    {2,-11634.5,81154.8},
-    {3,32114.3,71029.9},
+    {0,1,26102.4,107635},
+    {1,1,-37000.8,120939},
+    {2,1,11634.5,81154.8},
+    {3,1,-32114.3,71029.9},
   },
   // deep = 5
   {
-    {0,-67869.5,116791},
-    {1,-4766.23,120773},
-    {2,-53401.6,112381},
-    {3,-9652.8,74579.5},
-    {4,-41767.1,66471.4},
+    {0,1,67869.5,116791},
+    {1,1,4766.23,120773},
+    {2,1,53401.6,112381},
+    {3,1,9652.8,74579.5},
+    {4,1,41767.1,66471.4},
   },
   // deep = 6
   {
-    {0,-18490.4,108779},
-    {1,44612.9,137223},
-    {2,-4022.46,106489},
-    {3,39726.3,93455.4},
-    {4,7612.02,58291.9},
-    {5,49379.1,59952.3},
+    {0,1,18490.4,108779},
+    {1,1,-44612.9,137223},
+    {2,1,4022.46,106489},
+    {3,1,-39726.3,93455.4},
+    {4,1,-7612.02,58291.9},
+    {5,1,-49379.1,59952.3},
   },
   // deep = 7
   {
-    {0,-69925.6,120655},
-    {1,-6822.4,131132},
-    {2,-55457.7,120551},
-    {3,-11709,85367.1},
-    {4,-43823.2,77678.2},
-    {5,-2056.16,40870.4},
-    {6,-51435.3,56752.9},
+    {0,1,69925.6,120655},
+    {1,1,6822.4,131132},
+    {2,1,55457.7,120551},
+    {3,1,11709,85367.1},
+    {4,1,43823.2,77678.2},
+    {5,1,2056.16,40870.4},
+    {6,1,51435.3,56752.9},
   },
   // deep = 8
   {
-    {0,-5772.07,107693},
-    {1,57331.2,137557},
-    {2,8695.84,108292},
-    {3,52444.6,97466.9},
-    {4,20330.3,64310.9},
-    {5,62097.4,64059.3},
-    {6,12718.3,30191.5},
-    {7,64153.6,57481.4},
+    {0,1,5772.07,107693},
+    {1,1,-57331.2,137557},
+    {2,1,-8695.84,108292},
+    {3,1,-52444.6,97466.9},
+    {4,1,-20330.3,64310.9},
+    {5,1,-62097.4,64059.3},
+    {6,1,-12718.3,30191.5},
+    {7,1,-64153.6,57481.4},
   },
 },
 // move 21
@@ -1393,63 +1393,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-54856.6,111704},
+    {0,1,54856.6,111704},
   },
   // deep = 2
   {
-    {0,14074.8,100054},
-    {1,68931.3,119662},
+    {0,1,-14074.8,100054},
+    {1,1,-68931.3,119662},
   },
   // deep = 3
   {
-    {0,-12406.2,116311},
-    {1,42450.4,115890},
-    {2,-26480.9,72859.6},
+    {0,1,12406.2,116311},
+    {1,1,-42450.4,115890},
+    {2,1,26480.9,72859.6},
   },
   // deep = 4
   {
-    {0,38524.2,119048},
-    {1,93380.8,148412},
-    {2,24449.5,76136.4},
-    {3,50930.4,80066.7},
+    {0,1,-38524.2,119048},
+    {1,1,-93380.8,148412},
+    {2,1,-24449.5,76136.4},
+    {3,1,-50930.4,80066.7},
   },
   // deep = 5
   {
-    {0,-5631.03,121422},
-    {1,49225.5,139133},
-    {2,-19705.8,96588.8},
-    {3,6775.16,71512.9},
-    {4,-44155.3,62630.3},
+    {0,1,5631.03,121422},
+    {1,1,-49225.5,139133},
+    {2,1,19705.8,96588.8},
+    {3,1,-6775.16,71512.9},
+    {4,1,44155.3,62630.3},
   },
   // deep = 6
   {
-    {0,47399.5,120393},
-    {1,102256,160535},
-    {2,33324.7,94353.9},
-    {3,59805.7,96366.3},
-    {4,8875.22,52308.8},
-    {5,53030.5,59225.3},
+    {0,1,-47399.5,120393},
+    {1,1,-102256,160535},
+    {2,1,-33324.7,94353.9},
+    {3,1,-59805.7,96366.3},
+    {4,1,-8875.22,52308.8},
+    {5,1,-53030.5,59225.3},
   },
   // deep = 7
   {
-    {0,-8344.95,124841},
-    {1,46511.6,154173},
-    {2,-22419.7,104184},
-    {3,4061.24,88388.2},
-    {4,-46869.2,74198.7},
-    {5,-2713.93,47765.5},
-    {6,-55744.4,53706.4},
+    {0,1,8344.95,124841},
+    {1,1,-46511.6,154173},
+    {2,1,22419.7,104184},
+    {3,1,-4061.24,88388.2},
+    {4,1,46869.2,74198.7},
+    {5,1,2713.93,47765.5},
+    {6,1,55744.4,53706.4},
   },
   // deep = 8
   {
-    {0,45566.6,126304},
-    {1,100423,167828},
-    {2,31491.9,100982},
-    {3,57972.8,107154},
-    {4,7042.37,65522.9},
-    {5,51197.7,73788.2},
-    {6,-1832.85,37071.9},
-    {7,53911.6,60186.5},
+    {0,1,-45566.6,126304},
+    {1,1,-100423,167828},
+    {2,1,-31491.9,100982},
+    {3,1,-57972.8,107154},
+    {4,1,-7042.37,65522.9},
+    {5,1,-51197.7,73788.2},
+    {6,1,1832.85,37071.9},
+    {7,1,-53911.6,60186.5},
   },
 },
 // move 22
@@ -1459,63 +1459,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-69895.5,118846},
+    {0,1,69895.5,118846},
   },
   // deep = 2
   {
-    {0,-22974.6,110407},
-    {1,46920.8,106161},
+    {0,1,22974.6,110407},
+    {1,1,-46920.8,106161},
   },
   // deep = 3
   {
-    {0,-69052.7,139425},
-    {1,842.77,105406},
-    {2,-46078.1,90514.8},
+    {0,1,69052.7,139425},
+    {1,1,-842.77,105406},
+    {2,1,46078.1,90514.8},
   },
   // deep = 4
   {
-    {0,-15190.2,123603},
-    {1,54705.3,127744},
-    {2,7784.47,75334.5},
-    {3,53862.5,77426.5},
+    {0,1,15190.2,123603},
+    {1,1,-54705.3,127744},
+    {2,1,-7784.47,75334.5},
+    {3,1,-53862.5,77426.5},
   },
   // deep = 5
   {
-    {0,-62021.1,135652},
-    {1,7874.4,130546},
-    {2,-39046.4,105849},
-    {3,7031.63,80954.6},
-    {4,-46830.9,67068.8},
+    {0,1,62021.1,135652},
+    {1,1,-7874.4,130546},
+    {2,1,39046.4,105849},
+    {3,1,-7031.63,80954.6},
+    {4,1,46830.9,67068.8},
   },
   // deep = 6
   {
-    {0,-278.233,131210},
-    {1,69617.2,147173},
-    {2,22696.4,103856},
-    {3,68774.5,105657},
-    {4,14911.9,65751.5},
-    {5,61742.8,63666.5},
+    {0,1,278.233,131210},
+    {1,1,-69617.2,147173},
+    {2,1,-22696.4,103856},
+    {3,1,-68774.5,105657},
+    {4,1,-14911.9,65751.5},
+    {5,1,-61742.8,63666.5},
   },
   // deep = 7
   {
-    {0,-46264,145863},
-    {1,23631.5,147766},
-    {2,-23289.3,120811},
-    {3,22788.7,103986},
-    {4,-31073.8,88522.7},
-    {5,15757.1,57070.2},
-    {6,-45985.7,62585.5},
+    {0,1,46264,145863},
+    {1,1,-23631.5,147766},
+    {2,1,23289.3,120811},
+    {3,1,-22788.7,103986},
+    {4,1,31073.8,88522.7},
+    {5,1,-15757.1,57070.2},
+    {6,1,45985.7,62585.5},
   },
   // deep = 8
   {
-    {0,22050.1,137887},
-    {1,91945.5,154593},
-    {2,45024.7,113271},
-    {3,91102.8,115795},
-    {4,37240.3,77399.7},
-    {5,84071.1,75517.1},
-    {6,22328.3,37405.4},
-    {7,68314,62052.8},
+    {0,1,-22050.1,137887},
+    {1,1,-91945.5,154593},
+    {2,1,-45024.7,113271},
+    {3,1,-91102.8,115795},
+    {4,1,-37240.3,77399.7},
+    {5,1,-84071.1,75517.1},
+    {6,1,-22328.3,37405.4},
+    {7,1,-68314,62052.8},
   },
 },
 // move 23
@@ -1525,63 +1525,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-56113.6,113858},
+    {0,1,56113.6,113858},
   },
   // deep = 2
   {
-    {0,9969.82,118347},
-    {1,66083.4,125903},
+    {0,1,-9969.82,118347},
+    {1,1,-66083.4,125903},
   },
   // deep = 3
   {
-    {0,-42228.6,128178},
-    {1,13885,117094},
-    {2,-52198.4,93023.8},
+    {0,1,42228.6,128178},
+    {1,1,-13885,117094},
+    {2,1,52198.4,93023.8},
   },
   // deep = 4
   {
-    {0,18908.8,130654},
-    {1,75022.4,149749},
-    {2,8938.99,95347.9},
-    {3,61137.4,85064.8},
+    {0,1,-18908.8,130654},
+    {1,1,-75022.4,149749},
+    {2,1,-8938.99,95347.9},
+    {3,1,-61137.4,85064.8},
   },
   // deep = 5
   {
-    {0,-37059.7,134749},
-    {1,19054,146182},
-    {2,-47029.5,120335},
-    {3,5168.95,85448.8},
-    {4,-55968.5,69838.9},
+    {0,1,37059.7,134749},
+    {1,1,-19054,146182},
+    {2,1,47029.5,120335},
+    {3,1,-5168.95,85448.8},
+    {4,1,55968.5,69838.9},
   },
   // deep = 6
   {
-    {0,15679.7,134732},
-    {1,71793.3,164917},
-    {2,5709.87,122099},
-    {3,57908.3,114692},
-    {4,-3229.13,68676.6},
-    {5,52739.3,70203.7},
+    {0,1,-15679.7,134732},
+    {1,1,-71793.3,164917},
+    {2,1,-5709.87,122099},
+    {3,1,-57908.3,114692},
+    {4,1,3229.13,68676.6},
+    {5,1,-52739.3,70203.7},
   },
   // deep = 7
   {
-    {0,-46099.2,137227},
-    {1,10014.4,156336},
-    {2,-56069,128703},
-    {3,-3870.6,105185},
-    {4,-65008,85041.5},
-    {5,-9039.55,54361.5},
-    {6,-61778.9,64409.1},
+    {0,1,46099.2,137227},
+    {1,1,-10014.4,156336},
+    {2,1,56069,128703},
+    {3,1,3870.6,105185},
+    {4,1,65008,85041.5},
+    {5,1,9039.55,54361.5},
+    {6,1,61778.9,64409.1},
   },
   // deep = 8
   {
-    {0,33233.7,137322},
-    {1,89347.3,169706},
-    {2,23263.9,126901},
-    {3,75462.3,122315},
-    {4,14324.9,79036.7},
-    {5,70293.3,83533.7},
-    {6,17554,45579.8},
-    {7,79332.9,65235.5},
+    {0,1,-33233.7,137322},
+    {1,1,-89347.3,169706},
+    {2,1,-23263.9,126901},
+    {3,1,-75462.3,122315},
+    {4,1,-14324.9,79036.7},
+    {5,1,-70293.3,83533.7},
+    {6,1,-17554,45579.8},
+    {7,1,-79332.9,65235.5},
   },
 },
 // move 24
@@ -1591,63 +1591,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-80308.1,127045},
+    {0,1,80308.1,127045},
   },
   // deep = 2
   {
-    {0,6851.57,103372},
-    {1,87159.7,136136},
+    {0,1,-6851.57,103372},
+    {1,1,-87159.7,136136},
   },
   // deep = 3
   {
-    {0,-56198.9,138357},
-    {1,24109.2,125122},
-    {2,-63050.4,96001.9},
+    {0,1,56198.9,138357},
+    {1,1,-24109.2,125122},
+    {2,1,63050.4,96001.9},
   },
   // deep = 4
   {
-    {0,13172.4,119417},
-    {1,93480.5,157327},
-    {2,6320.85,83325.7},
-    {3,69371.3,94229.6},
+    {0,1,-13172.4,119417},
+    {1,1,-93480.5,157327},
+    {2,1,-6320.85,83325.7},
+    {3,1,-69371.3,94229.6},
   },
   // deep = 5
   {
-    {0,-36333.9,138471},
-    {1,43974.2,163426},
-    {2,-43185.5,115893},
-    {3,19865,97109.2},
-    {4,-49506.3,75202.1},
+    {0,1,36333.9,138471},
+    {1,1,-43974.2,163426},
+    {2,1,43185.5,115893},
+    {3,1,-19865,97109.2},
+    {4,1,49506.3,75202.1},
   },
   // deep = 6
   {
-    {0,35159.2,127006},
-    {1,115467,177277},
-    {2,28307.6,105959},
-    {3,91358,120480},
-    {4,21986.8,56288.1},
-    {5,71493.1,77416.1},
+    {0,1,-35159.2,127006},
+    {1,1,-115467,177277},
+    {2,1,-28307.6,105959},
+    {3,1,-91358,120480},
+    {4,1,-21986.8,56288.1},
+    {5,1,-71493.1,77416.1},
   },
   // deep = 7
   {
-    {0,-34588.6,140289},
-    {1,45719.5,179089},
-    {2,-41440.1,120118},
-    {3,21610.3,119350},
-    {4,-47761,80804.1},
-    {5,1745.3,65214.3},
-    {6,-69747.8,63420.3},
+    {0,1,34588.6,140289},
+    {1,1,-45719.5,179089},
+    {2,1,41440.1,120118},
+    {3,1,-21610.3,119350},
+    {4,1,47761,80804.1},
+    {5,1,-1745.3,65214.3},
+    {6,1,69747.8,63420.3},
   },
   // deep = 8
   {
-    {0,80251.2,128817},
-    {1,160559,181282},
-    {2,73399.6,106846},
-    {3,136450,127081},
-    {4,67078.8,68825.9},
-    {5,116585,89064.6},
-    {6,45092,38277.2},
-    {7,114840,62340.9},
+    {0,1,-80251.2,128817},
+    {1,1,-160559,181282},
+    {2,1,-73399.6,106846},
+    {3,1,-136450,127081},
+    {4,1,-67078.8,68825.9},
+    {5,1,-116585,89064.6},
+    {6,1,-45092,38277.2},
+    {7,1,-114840,62340.9},
   },
 },
 // move 25
@@ -1657,63 +1657,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-73277.3,125682},
+    {0,1,73277.3,125682},
   },
   // deep = 2
   {
-    {0,-330.049,140248},
-    {1,72947.2,126308},
+    {0,1,330.049,140248},
+    {1,1,-72947.2,126308},
   },
   // deep = 3
   {
-    {0,-68370.1,163010},
-    {1,4907.18,124285},
-    {2,-68040.1,101077},
+    {0,1,68370.1,163010},
+    {1,1,-4907.18,124285},
+    {2,1,68040.1,101077},
   },
   // deep = 4
   {
-    {0,-6409.72,159434},
-    {1,66867.6,153707},
-    {2,-6079.67,100528},
-    {3,61960.4,99474.9},
+    {0,1,6409.72,159434},
+    {1,1,-66867.6,153707},
+    {2,1,6079.67,100528},
+    {3,1,-61960.4,99474.9},
   },
   // deep = 5
   {
-    {0,-64438.1,157704},
-    {1,8839.17,148501},
-    {2,-64108.1,125046},
-    {3,3931.99,93058.7},
-    {4,-58028.4,80708.3},
+    {0,1,64438.1,157704},
+    {1,1,-8839.17,148501},
+    {2,1,64108.1,125046},
+    {3,1,-3931.99,93058.7},
+    {4,1,58028.4,80708.3},
   },
   // deep = 6
   {
-    {0,8982.65,154047},
-    {1,82259.9,161807},
-    {2,9312.7,119667},
-    {3,77352.8,114378},
-    {4,15392.4,68082.5},
-    {5,73420.8,71565.4},
+    {0,1,-8982.65,154047},
+    {1,1,-82259.9,161807},
+    {2,1,-9312.7,119667},
+    {3,1,-77352.8,114378},
+    {4,1,-15392.4,68082.5},
+    {5,1,-73420.8,71565.4},
   },
   // deep = 7
   {
-    {0,-97321.1,152970},
-    {1,-24043.8,151787},
-    {2,-96991,127702},
-    {3,-28951,108150},
-    {4,-90911.4,90604.4},
-    {5,-32883,55805.9},
-    {6,-106304,61916.5},
+    {0,1,97321.1,152970},
+    {1,1,24043.8,151787},
+    {2,1,96991,127702},
+    {3,1,28951,108150},
+    {4,1,90911.4,90604.4},
+    {5,1,32883,55805.9},
+    {6,1,106304,61916.5},
   },
   // deep = 8
   {
-    {0,23439.6,157665},
-    {1,96716.9,168353},
-    {2,23769.6,124128},
-    {3,91809.7,119850},
-    {4,29849.3,80483.3},
-    {5,87877.7,79896.5},
-    {6,14456.9,40406.9},
-    {7,120761,65301},
+    {0,1,-23439.6,157665},
+    {1,1,-96716.9,168353},
+    {2,1,-23769.6,124128},
+    {3,1,-91809.7,119850},
+    {4,1,-29849.3,80483.3},
+    {5,1,-87877.7,79896.5},
+    {6,1,-14456.9,40406.9},
+    {7,1,-120761,65301},
   },
 },
 // move 26
@@ -1723,63 +1723,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-92314.7,137951},
+    {0,1,92314.7,137951},
   },
   // deep = 2
   {
-    {0,20028.5,134806},
-    {1,112343,148798},
+    {0,1,-20028.5,134806},
+    {1,1,-112343,148798},
   },
   // deep = 3
   {
-    {0,-35426.8,163815},
-    {1,56887.9,161349},
-    {2,-55455.3,123227},
+    {0,1,35426.8,163815},
+    {1,1,-56887.9,161349},
+    {2,1,55455.3,123227},
   },
   // deep = 4
   {
-    {0,29427.5,145805},
-    {1,121742,175328},
-    {2,9399.03,108247},
-    {3,64854.3,104372},
+    {0,1,-29427.5,145805},
+    {1,1,-121742,175328},
+    {2,1,-9399.03,108247},
+    {3,1,-64854.3,104372},
   },
   // deep = 5
   {
-    {0,-34027.6,160696},
-    {1,58287.1,176812},
-    {2,-54056.1,133055},
-    {3,1399.2,85424.1},
-    {4,-63455.1,84705.7},
+    {0,1,34027.6,160696},
+    {1,1,-58287.1,176812},
+    {2,1,54056.1,133055},
+    {3,1,-1399.2,85424.1},
+    {4,1,63455.1,84705.7},
   },
   // deep = 6
   {
-    {0,74925.2,144084},
-    {1,167240,183257},
-    {2,54896.7,121642},
-    {3,110352,118226},
-    {4,45497.7,56564},
-    {5,108953,83623.9},
+    {0,1,-74925.2,144084},
+    {1,1,-167240,183257},
+    {2,1,-54896.7,121642},
+    {3,1,-110352,118226},
+    {4,1,-45497.7,56564},
+    {5,1,-108953,83623.9},
   },
   // deep = 7
   {
-    {0,-35819.1,164448},
-    {1,56495.6,191710},
-    {2,-55847.6,140384},
-    {3,-392.32,109225},
-    {4,-65246.6,93985},
-    {5,-1791.52,57817.5},
-    {6,-110744,79088.7},
+    {0,1,35819.1,164448},
+    {1,1,-56495.6,191710},
+    {2,1,55847.6,140384},
+    {3,1,392.32,109225},
+    {4,1,65246.6,93985},
+    {5,1,1791.52,57817.5},
+    {6,1,110744,79088.7},
   },
   // deep = 8
   {
-    {0,81035.2,146604},
-    {1,173350,185235},
-    {2,61006.8,124042},
-    {3,116462,128824},
-    {4,51607.7,75977.4},
-    {5,115063,97846},
-    {6,6110,50632.1},
-    {7,116854,82910.1},
+    {0,1,-81035.2,146604},
+    {1,1,-173350,185235},
+    {2,1,-61006.8,124042},
+    {3,1,-116462,128824},
+    {4,1,-51607.7,75977.4},
+    {5,1,-115063,97846},
+    {6,1,-6110,50632.1},
+    {7,1,-116854,82910.1},
   },
 },
 // move 27
@@ -1789,63 +1789,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-105855,134318},
+    {0,1,105855,134318},
   },
   // deep = 2
   {
-    {0,-21930.4,143049},
-    {1,83924.4,148772},
+    {0,1,21930.4,143049},
+    {1,1,-83924.4,148772},
   },
   // deep = 3
   {
-    {0,-83649.4,155584},
-    {1,22205.4,135675},
-    {2,-61719,114696},
+    {0,1,83649.4,155584},
+    {1,1,-22205.4,135675},
+    {2,1,61719,114696},
   },
   // deep = 4
   {
-    {0,819.47,150853},
-    {1,106674,170424},
-    {2,22749.8,91281.3},
-    {3,84468.8,116653},
+    {0,1,-819.47,150853},
+    {1,1,-106674,170424},
+    {2,1,-22749.8,91281.3},
+    {3,1,-84468.8,116653},
   },
   // deep = 5
   {
-    {0,-98606.3,147829},
-    {1,7248.49,161184},
-    {2,-76675.9,131046},
-    {3,-14956.9,99444},
-    {4,-99425.7,98149.6},
+    {0,1,98606.3,147829},
+    {1,1,-7248.49,161184},
+    {2,1,76675.9,131046},
+    {3,1,14956.9,99444},
+    {4,1,99425.7,98149.6},
   },
   // deep = 6
   {
-    {0,18559.8,157519},
-    {1,124415,189185},
-    {2,40490.2,118149},
-    {3,102209,137569},
-    {4,17740.4,68019.8},
-    {5,117166,94659.7},
+    {0,1,-18559.8,157519},
+    {1,1,-124415,189185},
+    {2,1,-40490.2,118149},
+    {3,1,-102209,137569},
+    {4,1,-17740.4,68019.8},
+    {5,1,-117166,94659.7},
   },
   // deep = 7
   {
-    {0,-86285,156493},
-    {1,19569.8,181750},
-    {2,-64354.6,149181},
-    {3,-2635.61,130288},
-    {4,-87104.5,115279},
-    {5,12321.3,72872.1},
-    {6,-104845,88841.6},
+    {0,1,86285,156493},
+    {1,1,-19569.8,181750},
+    {2,1,64354.6,149181},
+    {3,1,2635.61,130288},
+    {4,1,87104.5,115279},
+    {5,1,-12321.3,72872.1},
+    {6,1,104845,88841.6},
   },
   // deep = 8
   {
-    {0,74569.5,165699},
-    {1,180424,198045},
-    {2,96499.8,130247},
-    {3,158219,147761},
-    {4,73750,81816.9},
-    {5,173176,107641},
-    {6,56009.7,47242.4},
-    {7,160854,90290.4},
+    {0,1,-74569.5,165699},
+    {1,1,-180424,198045},
+    {2,1,-96499.8,130247},
+    {3,1,-158219,147761},
+    {4,1,-73750,81816.9},
+    {5,1,-173176,107641},
+    {6,1,-56009.7,47242.4},
+    {7,1,-160854,90290.4},
   },
 },
 // move 28
@@ -1855,63 +1855,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-80839.6,145130},
+    {0,1,80839.6,145130},
   },
   // deep = 2
   {
-    {0,11086,129572},
-    {1,91925.6,147376},
+    {0,1,-11086,129572},
+    {1,1,-91925.6,147376},
   },
   // deep = 3
   {
-    {0,-69836.1,157075},
-    {1,11003.5,132025},
-    {2,-80922.1,116868},
+    {0,1,69836.1,157075},
+    {1,1,-11003.5,132025},
+    {2,1,80922.1,116868},
   },
   // deep = 4
   {
-    {0,48330.4,140411},
-    {1,129170,172470},
-    {2,37244.4,99363.7},
-    {3,118167,111780},
+    {0,1,-48330.4,140411},
+    {1,1,-129170,172470},
+    {2,1,-37244.4,99363.7},
+    {3,1,-118167,111780},
   },
   // deep = 5
   {
-    {0,-64520,155325},
-    {1,16319.6,154708},
-    {2,-75606,130840},
-    {3,5316.08,84260.9},
-    {4,-112850,93750.1},
+    {0,1,64520,155325},
+    {1,1,-16319.6,154708},
+    {2,1,75606,130840},
+    {3,1,-5316.08,84260.9},
+    {4,1,112850,93750.1},
   },
   // deep = 6
   {
-    {0,49286.4,149262},
-    {1,130126,190864},
-    {2,38200.4,128195},
-    {3,119123,133781},
-    {4,956.018,70979.8},
-    {5,113806,99032.4},
+    {0,1,-49286.4,149262},
+    {1,1,-130126,190864},
+    {2,1,-38200.4,128195},
+    {3,1,-119123,133781},
+    {4,1,-956.018,70979.8},
+    {5,1,-113806,99032.4},
   },
   // deep = 7
   {
-    {0,-104643,161502},
-    {1,-23803.8,172904},
-    {2,-115729,138638},
-    {3,-34807.3,107138},
-    {4,-152974,102262},
-    {5,-40123.4,63644.5},
-    {6,-153930,91500.5},
+    {0,1,104643,161502},
+    {1,1,23803.8,172904},
+    {2,1,115729,138638},
+    {3,1,34807.3,107138},
+    {4,1,152974,102262},
+    {5,1,40123.4,63644.5},
+    {6,1,153930,91500.5},
   },
   // deep = 8
   {
-    {0,53429.8,158984},
-    {1,134269,197420},
-    {2,42343.8,134560},
-    {3,123266,142082},
-    {4,5099.37,85996.9},
-    {5,117950,111842},
-    {6,4143.35,52289},
-    {7,158073,94368.8},
+    {0,1,-53429.8,158984},
+    {1,1,-134269,197420},
+    {2,1,-42343.8,134560},
+    {3,1,-123266,142082},
+    {4,1,-5099.37,85996.9},
+    {5,1,-117950,111842},
+    {6,1,-4143.35,52289},
+    {7,1,-158073,94368.8},
   },
 },
 // move 29
@@ -1921,63 +1921,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-98334.6,155792},
+    {0,1,98334.6,155792},
   },
   // deep = 2
   {
-    {0,21086.4,124763},
-    {1,119421,165284},
+    {0,1,-21086.4,124763},
+    {1,1,-119421,165284},
   },
   // deep = 3
   {
-    {0,-91030.5,160707},
-    {1,7304.04,140003},
-    {2,-112117,124707},
+    {0,1,91030.5,160707},
+    {1,1,-7304.04,140003},
+    {2,1,112117,124707},
   },
   // deep = 4
   {
-    {0,34376.8,132746},
-    {1,132711,184984},
-    {2,13290.4,97952.2},
-    {3,125407,118190},
+    {0,1,-34376.8,132746},
+    {1,1,-132711,184984},
+    {2,1,-13290.4,97952.2},
+    {3,1,-125407,118190},
   },
   // deep = 5
   {
-    {0,-68863,167179},
-    {1,29471.6,175262},
-    {2,-89949.4,147012},
-    {3,22167.6,96720.9},
-    {4,-103240,108966},
+    {0,1,68863,167179},
+    {1,1,-29471.6,175262},
+    {2,1,89949.4,147012},
+    {3,1,-22167.6,96720.9},
+    {4,1,103240,108966},
   },
   // deep = 6
   {
-    {0,87568.7,144023},
-    {1,185903,201446},
-    {2,66482.4,115594},
-    {3,178599,133989},
-    {4,53192,66162.1},
-    {5,156432,109512},
+    {0,1,-87568.7,144023},
+    {1,1,-185903,201446},
+    {2,1,-66482.4,115594},
+    {3,1,-178599,133989},
+    {4,1,-53192,66162.1},
+    {5,1,-156432,109512},
   },
   // deep = 7
   {
-    {0,-52326.6,175796},
-    {1,46008,196166},
-    {2,-73412.9,159084},
-    {3,38704,122945},
-    {4,-86703.3,124830},
-    {5,16536.4,69903.9},
-    {6,-139895,107206},
+    {0,1,52326.6,175796},
+    {1,1,-46008,196166},
+    {2,1,73412.9,159084},
+    {3,1,-38704,122945},
+    {4,1,86703.3,124830},
+    {5,1,-16536.4,69903.9},
+    {6,1,139895,107206},
   },
   // deep = 8
   {
-    {0,94355.6,154390},
-    {1,192690,214963},
-    {2,73269.2,130516},
-    {3,185386,149812},
-    {4,59978.8,85649.3},
-    {5,163219,123941},
-    {6,6786.85,52980.1},
-    {7,146682,111276},
+    {0,1,-94355.6,154390},
+    {1,1,-192690,214963},
+    {2,1,-73269.2,130516},
+    {3,1,-185386,149812},
+    {4,1,-59978.8,85649.3},
+    {5,1,-163219,123941},
+    {6,1,-6786.85,52980.1},
+    {7,1,-146682,111276},
   },
 },
 // move 30
@@ -1987,63 +1987,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-108980,161133},
+    {0,1,108980,161133},
   },
   // deep = 2
   {
-    {0,27678.5,159843},
-    {1,136658,160530},
+    {0,1,-27678.5,159843},
+    {1,1,-136658,160530},
   },
   // deep = 3
   {
-    {0,-79232.3,185835},
-    {1,29747.2,145215},
-    {2,-106911,126650},
+    {0,1,79232.3,185835},
+    {1,1,-29747.2,145215},
+    {2,1,106911,126650},
   },
   // deep = 4
   {
-    {0,39932.5,178692},
-    {1,148912,195646},
-    {2,12254,117992},
-    {3,119165,132117},
+    {0,1,-39932.5,178692},
+    {1,1,-148912,195646},
+    {2,1,-12254,117992},
+    {3,1,-119165,132117},
   },
   // deep = 5
   {
-    {0,-103889,187697},
-    {1,5090.3,165112},
-    {2,-131568,149430},
-    {3,-24656.9,102380},
-    {4,-143822,116764},
+    {0,1,103889,187697},
+    {1,1,-5090.3,165112},
+    {2,1,131568,149430},
+    {3,1,24656.9,102380},
+    {4,1,143822,116764},
   },
   // deep = 6
   {
-    {0,44309.2,182954},
-    {1,153289,207201},
-    {2,16630.7,139413},
-    {3,123542,150102},
-    {4,4376.74,76890.8},
-    {5,148198,119709},
+    {0,1,-44309.2,182954},
+    {1,1,-153289,207201},
+    {2,1,-16630.7,139413},
+    {3,1,-123542,150102},
+    {4,1,-4376.74,76890.8},
+    {5,1,-148198,119709},
   },
   // deep = 7
   {
-    {0,-89292.4,197410},
-    {1,19687.1,184869},
-    {2,-116971,163714},
-    {3,-10060.1,123698},
-    {4,-129225,129519},
-    {5,14596.8,71431.8},
-    {6,-133602,116236},
+    {0,1,89292.4,197410},
+    {1,1,-19687.1,184869},
+    {2,1,116971,163714},
+    {3,1,10060.1,123698},
+    {4,1,129225,129519},
+    {5,1,-14596.8,71431.8},
+    {6,1,133602,116236},
   },
   // deep = 8
   {
-    {0,108215,186803},
-    {1,217194,212585},
-    {2,80536.2,146905},
-    {3,187447,157587},
-    {4,68282.3,91821.3},
-    {5,212104,126422},
-    {6,63905.5,46855.8},
-    {7,197507,115773},
+    {0,1,-108215,186803},
+    {1,1,-217194,212585},
+    {2,1,-80536.2,146905},
+    {3,1,-187447,157587},
+    {4,1,-68282.3,91821.3},
+    {5,1,-212104,126422},
+    {6,1,-63905.5,46855.8},
+    {7,1,-197507,115773},
   },
 },
 // move 31
@@ -2053,63 +2053,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-136315,171149},
+    {0,1,136315,171149},
   },
   // deep = 2
   {
-    {0,6641.48,153159},
-    {1,142956,158041},
+    {0,1,-6641.48,153159},
+    {1,1,-142956,158041},
   },
   // deep = 3
   {
-    {0,-101903,200671},
-    {1,34411.5,157999},
-    {2,-108545,140342},
+    {0,1,101903,200671},
+    {1,1,-34411.5,157999},
+    {2,1,108545,140342},
   },
   // deep = 4
   {
-    {0,52186.4,160178},
-    {1,188501,183338},
-    {2,45544.9,110621},
-    {3,154090,137643},
+    {0,1,-52186.4,160178},
+    {1,1,-188501,183338},
+    {2,1,-45544.9,110621},
+    {3,1,-154090,137643},
   },
   // deep = 5
   {
-    {0,-84055.6,205373},
-    {1,52259.4,183183},
-    {2,-90697,160272},
-    {3,17847.8,94865.4},
-    {4,-136242,124978},
+    {0,1,84055.6,205373},
+    {1,1,-52259.4,183183},
+    {2,1,90697,160272},
+    {3,1,-17847.8,94865.4},
+    {4,1,136242,124978},
   },
   // deep = 6
   {
-    {0,50768,179298},
-    {1,187083,202606},
-    {2,44126.5,132279},
-    {3,152671,154448},
-    {4,-1418.4,74439.3},
-    {5,134824,124879},
+    {0,1,-50768,179298},
+    {1,1,-187083,202606},
+    {2,1,-44126.5,132279},
+    {3,1,-152671,154448},
+    {4,1,1418.4,74439.3},
+    {5,1,-134824,124879},
   },
   // deep = 7
   {
-    {0,-136087,210896},
-    {1,228.233,198584},
-    {2,-142728,169706},
-    {3,-34183.3,115167},
-    {4,-188273,133411},
-    {5,-52031.2,54156.3},
-    {6,-186855,125626},
+    {0,1,136087,210896},
+    {1,1,-228.233,198584},
+    {2,1,142728,169706},
+    {3,1,34183.3,115167},
+    {4,1,188273,133411},
+    {5,1,52031.2,54156.3},
+    {6,1,186855,125626},
   },
   // deep = 8
   {
-    {0,71983.3,184261},
-    {1,208298,214270},
-    {2,65341.9,147050},
-    {3,173887,165153},
-    {4,19797,98457},
-    {5,156039,135962},
-    {6,21215.4,59173.1},
-    {7,208070,129845},
+    {0,1,-71983.3,184261},
+    {1,1,-208298,214270},
+    {2,1,-65341.9,147050},
+    {3,1,-173887,165153},
+    {4,1,-19797,98457},
+    {5,1,-156039,135962},
+    {6,1,-21215.4,59173.1},
+    {7,1,-208070,129845},
   },
 },
 // move 32
@@ -2119,63 +2119,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-130964,163591},
+    {0,1,130964,163591},
   },
   // deep = 2
   {
-    {0,6236.97,165759},
-    {1,137201,173730},
+    {0,1,-6236.97,165759},
+    {1,1,-137201,173730},
   },
   // deep = 3
   {
-    {0,-129703,187140},
-    {1,1261.27,146382},
-    {2,-135939,158475},
+    {0,1,129703,187140},
+    {1,1,-1261.27,146382},
+    {2,1,135939,158475},
   },
   // deep = 4
   {
-    {0,19766.5,178838},
-    {1,150730,191337},
-    {2,13529.5,109110},
-    {3,149469,148238},
+    {0,1,-19766.5,178838},
+    {1,1,-150730,191337},
+    {2,1,-13529.5,109110},
+    {3,1,-149469,148238},
   },
   // deep = 5
   {
-    {0,-103980,194324},
-    {1,26984.1,157541},
-    {2,-110217,165182},
-    {3,25722.9,89745.7},
-    {4,-123746,136020},
+    {0,1,103980,194324},
+    {1,1,-26984.1,157541},
+    {2,1,110217,165182},
+    {3,1,-25722.9,89745.7},
+    {4,1,123746,136020},
   },
   // deep = 6
   {
-    {0,80600.4,185881},
-    {1,211564,198674},
-    {2,74363.4,122942},
-    {3,210303,156559},
-    {4,60833.9,64118.5},
-    {5,184580,136013},
+    {0,1,-80600.4,185881},
+    {1,1,-211564,198674},
+    {2,1,-74363.4,122942},
+    {3,1,-210303,156559},
+    {4,1,-60833.9,64118.5},
+    {5,1,-184580,136013},
   },
   // deep = 7
   {
-    {0,-108974,212427},
-    {1,21989.7,185139},
-    {2,-115211,179825},
-    {3,20728.5,122308},
-    {4,-128741,148348},
-    {5,-4994.41,76558.4},
-    {6,-189574,135192},
+    {0,1,108974,212427},
+    {1,1,-21989.7,185139},
+    {2,1,115211,179825},
+    {3,1,-20728.5,122308},
+    {4,1,128741,148348},
+    {5,1,4994.41,76558.4},
+    {6,1,189574,135192},
   },
   // deep = 8
   {
-    {0,99460.5,199089},
-    {1,230424,211822},
-    {2,93223.5,146168},
-    {3,229163,169926},
-    {4,79694,93435.5},
-    {5,203440,149880},
-    {6,18860.1,61222.4},
-    {7,208435,133968},
+    {0,1,-99460.5,199089},
+    {1,1,-230424,211822},
+    {2,1,-93223.5,146168},
+    {3,1,-229163,169926},
+    {4,1,-79694,93435.5},
+    {5,1,-203440,149880},
+    {6,1,-18860.1,61222.4},
+    {7,1,-208435,133968},
   },
 },
 // move 33
@@ -2185,63 +2185,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-136089,184933},
+    {0,1,136089,184933},
   },
   // deep = 2
   {
-    {0,31486.3,157706},
-    {1,167575,185642},
+    {0,1,-31486.3,157706},
+    {1,1,-167575,185642},
   },
   // deep = 3
   {
-    {0,-103741,204337},
-    {1,32348.3,157749},
-    {2,-135227,159230},
+    {0,1,103741,204337},
+    {1,1,-32348.3,157749},
+    {2,1,135227,159230},
   },
   // deep = 4
   {
-    {0,33140.6,166881},
-    {1,169229,206753},
-    {2,1654.22,97309.8},
-    {3,136881,152581},
+    {0,1,-33140.6,166881},
+    {1,1,-169229,206753},
+    {2,1,-1654.22,97309.8},
+    {3,1,-136881,152581},
   },
   // deep = 5
   {
-    {0,-138458,200379},
-    {1,-2368.99,177464},
-    {2,-169944,163380},
-    {3,-34717.3,86531.3},
-    {4,-171598,142000},
+    {0,1,138458,200379},
+    {1,1,2368.99,177464},
+    {2,1,169944,163380},
+    {3,1,34717.3,86531.3},
+    {4,1,171598,142000},
   },
   // deep = 6
   {
-    {0,47086.7,184662},
-    {1,183176,223559},
-    {2,15600.3,128034},
-    {3,150827,173667},
-    {4,13946.1,81403.9},
-    {5,185545,149506},
+    {0,1,-47086.7,184662},
+    {1,1,-183176,223559},
+    {2,1,-15600.3,128034},
+    {3,1,-150827,173667},
+    {4,1,-13946.1,81403.9},
+    {5,1,-185545,149506},
   },
   // deep = 7
   {
-    {0,-137859,215850},
-    {1,-1770.4,208129},
-    {2,-169346,185135},
-    {3,-34118.7,124787},
-    {4,-171000,159546},
-    {5,598.592,76578.5},
-    {6,-184946,149038},
+    {0,1,137859,215850},
+    {1,1,1770.4,208129},
+    {2,1,169346,185135},
+    {3,1,34118.7,124787},
+    {4,1,171000,159546},
+    {5,1,-598.592,76578.5},
+    {6,1,184946,149038},
   },
   // deep = 8
   {
-    {0,84963.9,195420},
-    {1,221053,235684},
-    {2,53477.5,143067},
-    {3,188704,183655},
-    {4,51823.3,97523.7},
-    {5,223422,157637},
-    {6,37877.2,45175.2},
-    {7,222823,151961},
+    {0,1,-84963.9,195420},
+    {1,1,-221053,235684},
+    {2,1,-53477.5,143067},
+    {3,1,-188704,183655},
+    {4,1,-51823.3,97523.7},
+    {5,1,-223422,157637},
+    {6,1,-37877.2,45175.2},
+    {7,1,-222823,151961},
   },
 },
 // move 34
@@ -2251,63 +2251,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-149594,179899},
+    {0,1,149594,179899},
   },
   // deep = 2
   {
-    {0,7779.24,167200},
-    {1,157373,191477},
+    {0,1,-7779.24,167200},
+    {1,1,-157373,191477},
   },
   // deep = 3
   {
-    {0,-114688,205625},
-    {1,34906,143294},
-    {2,-122467,161144},
+    {0,1,114688,205625},
+    {1,1,-34906,143294},
+    {2,1,122467,161144},
   },
   // deep = 4
   {
-    {0,65438,177802},
-    {1,215032,203473},
-    {2,57658.8,101311},
-    {3,180126,155062},
+    {0,1,-65438,177802},
+    {1,1,-215032,203473},
+    {2,1,-57658.8,101311},
+    {3,1,-180126,155062},
   },
   // deep = 5
   {
-    {0,-101663,225409},
-    {1,47931.2,172761},
-    {2,-109442,178327},
-    {3,13025.2,95787.9},
-    {4,-167101,152293},
+    {0,1,101663,225409},
+    {1,1,-47931.2,172761},
+    {2,1,109442,178327},
+    {3,1,-13025.2,95787.9},
+    {4,1,167101,152293},
   },
   // deep = 6
   {
-    {0,80428.1,198983},
-    {1,230022,221566},
-    {2,72648.9,132085},
-    {3,195116,172810},
-    {4,14990.1,76874.5},
-    {5,182091,156690},
+    {0,1,-80428.1,198983},
+    {1,1,-230022,221566},
+    {2,1,-72648.9,132085},
+    {3,1,-195116,172810},
+    {4,1,-14990.1,76874.5},
+    {5,1,-182091,156690},
   },
   // deep = 7
   {
-    {0,-124987,236676},
-    {1,24607,192329},
-    {2,-132766,190292},
-    {3,-10298.9,116437},
-    {4,-190425,163224},
-    {5,-23324.2,57786.9},
-    {6,-205415,160738},
+    {0,1,124987,236676},
+    {1,1,-24607,192329},
+    {2,1,132766,190292},
+    {3,1,10298.9,116437},
+    {4,1,190425,163224},
+    {5,1,23324.2,57786.9},
+    {6,1,205415,160738},
   },
   // deep = 8
   {
-    {0,132121,213704},
-    {1,281715,237104},
-    {2,124342,148713},
-    {3,246809,188361},
-    {4,66682.9,98958.3},
-    {5,233784,167349},
-    {6,51692.9,51021},
-    {7,257108,167683},
+    {0,1,-132121,213704},
+    {1,1,-281715,237104},
+    {2,1,-124342,148713},
+    {3,1,-246809,188361},
+    {4,1,-66682.9,98958.3},
+    {5,1,-233784,167349},
+    {6,1,-51692.9,51021},
+    {7,1,-257108,167683},
   },
 },
 // move 35
@@ -2317,63 +2317,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-139718,197564},
+    {0,1,139718,197564},
   },
   // deep = 2
   {
-    {0,-2092.03,158472},
-    {1,137626,183705},
+    {0,1,2092.03,158472},
+    {1,1,-137626,183705},
   },
   // deep = 3
   {
-    {0,-159815,216042},
-    {1,-20097.2,146918},
-    {2,-157723,170297},
+    {0,1,159815,216042},
+    {1,1,20097.2,146918},
+    {2,1,157723,170297},
   },
   // deep = 4
   {
-    {0,14430.6,177098},
-    {1,154149,198644},
-    {2,16522.6,105666},
-    {3,174246,168642},
+    {0,1,-14430.6,177098},
+    {1,1,-154149,198644},
+    {2,1,-16522.6,105666},
+    {3,1,-174246,168642},
   },
   // deep = 5
   {
-    {0,-155387,231145},
-    {1,-15669,173089},
-    {2,-153295,191010},
-    {3,4428.24,99173},
-    {4,-169818,173193},
+    {0,1,155387,231145},
+    {1,1,15669,173089},
+    {2,1,153295,191010},
+    {3,1,-4428.24,99173},
+    {4,1,169818,173193},
   },
   // deep = 6
   {
-    {0,45427.4,190871},
-    {1,185145,210616},
-    {2,47519.4,131955},
-    {3,205243,180461},
-    {4,30996.8,71764.4},
-    {5,200814,175076},
+    {0,1,-45427.4,190871},
+    {1,1,-185145,210616},
+    {2,1,-47519.4,131955},
+    {3,1,-205243,180461},
+    {4,1,-30996.8,71764.4},
+    {5,1,-200814,175076},
   },
   // deep = 7
   {
-    {0,-191809,251583},
-    {1,-52090.9,194553},
-    {2,-189717,209685},
-    {3,-31993.7,125217},
-    {4,-206240,185274},
-    {5,-36421.9,65631.7},
-    {6,-237236,180563},
+    {0,1,191809,251583},
+    {1,1,52090.9,194553},
+    {2,1,189717,209685},
+    {3,1,31993.7,125217},
+    {4,1,206240,185274},
+    {5,1,36421.9,65631.7},
+    {6,1,237236,180563},
   },
   // deep = 8
   {
-    {0,131579,202300},
-    {1,271297,216182},
-    {2,133671,143677},
-    {3,291394,186267},
-    {4,117148,88954.3},
-    {5,286966,178021},
-    {6,86151.3,50001.3},
-    {7,323388,180069},
+    {0,1,-131579,202300},
+    {1,1,-271297,216182},
+    {2,1,-133671,143677},
+    {3,1,-291394,186267},
+    {4,1,-117148,88954.3},
+    {5,1,-286966,178021},
+    {6,1,-86151.3,50001.3},
+    {7,1,-323388,180069},
   },
 },
 // move 36
@@ -2383,63 +2383,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-128511,207610},
+    {0,1,128511,207610},
   },
   // deep = 2
   {
-    {0,36512.8,187270},
-    {1,165024,204242},
+    {0,1,-36512.8,187270},
+    {1,1,-165024,204242},
   },
   // deep = 3
   {
-    {0,-102686,234462},
-    {1,25825.2,163601},
-    {2,-139199,185383},
+    {0,1,102686,234462},
+    {1,1,-25825.2,163601},
+    {2,1,139199,185383},
   },
   // deep = 4
   {
-    {0,64846.2,208187},
-    {1,193358,226799},
-    {2,28333.4,105791},
-    {3,167532,186561},
+    {0,1,-64846.2,208187},
+    {1,1,-193358,226799},
+    {2,1,-28333.4,105791},
+    {3,1,-167532,186561},
   },
   // deep = 5
   {
-    {0,-114348,244562},
-    {1,14163.7,180642},
-    {2,-150861,193631},
-    {3,-11661.5,88819.3},
-    {4,-179194,185751},
+    {0,1,114348,244562},
+    {1,1,-14163.7,180642},
+    {2,1,150861,193631},
+    {3,1,11661.5,88819.3},
+    {4,1,179194,185751},
   },
   // deep = 6
   {
-    {0,112525,216603},
-    {1,241037,238299},
-    {2,76012.6,124554},
-    {3,215212,193884},
-    {4,47679.1,72907.8},
-    {5,226873,189772},
+    {0,1,-112525,216603},
+    {1,1,-241037,238299},
+    {2,1,-76012.6,124554},
+    {3,1,-215212,193884},
+    {4,1,-47679.1,72907.8},
+    {5,1,-226873,189772},
   },
   // deep = 7
   {
-    {0,-185004,254668},
-    {1,-56493,199138},
-    {2,-221517,203628},
-    {3,-82318.2,115224},
-    {4,-249851,196619},
-    {5,-70656.7,60681.4},
-    {6,-297530,195482},
+    {0,1,185004,254668},
+    {1,1,56493,199138},
+    {2,1,221517,203628},
+    {3,1,82318.2,115224},
+    {4,1,249851,196619},
+    {5,1,70656.7,60681.4},
+    {6,1,297530,195482},
   },
   // deep = 8
   {
-    {0,155106,220790},
-    {1,283618,244244},
-    {2,118593,138919},
-    {3,257792,200329},
-    {4,90259.9,89382},
-    {5,269454,192009},
-    {6,42580.7,51794},
-    {7,340111,194954},
+    {0,1,-155106,220790},
+    {1,1,-283618,244244},
+    {2,1,-118593,138919},
+    {3,1,-257792,200329},
+    {4,1,-90259.9,89382},
+    {5,1,-269454,192009},
+    {6,1,-42580.7,51794},
+    {7,1,-340111,194954},
   },
 },
 // move 37
@@ -2449,63 +2449,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-156641,224195},
+    {0,1,156641,224195},
   },
   // deep = 2
   {
-    {0,10276.7,200863},
-    {1,166918,212977},
+    {0,1,-10276.7,200863},
+    {1,1,-166918,212977},
   },
   // deep = 3
   {
-    {0,-136872,259095},
-    {1,19769.6,156483},
-    {2,-147149,202177},
+    {0,1,136872,259095},
+    {1,1,-19769.6,156483},
+    {2,1,147149,202177},
   },
   // deep = 4
   {
-    {0,48740.2,201428},
-    {1,205382,227247},
-    {2,38463.5,127703},
-    {3,185612,208388},
+    {0,1,-48740.2,201428},
+    {1,1,-205382,227247},
+    {2,1,-38463.5,127703},
+    {3,1,-185612,208388},
   },
   // deep = 5
   {
-    {0,-153760,269276},
-    {1,2881.29,176954},
-    {2,-164037,214857},
-    {3,-16888.3,98376.3},
-    {4,-202500,210372},
+    {0,1,153760,269276},
+    {1,1,-2881.29,176954},
+    {2,1,164037,214857},
+    {3,1,16888.3,98376.3},
+    {4,1,202500,210372},
   },
   // deep = 6
   {
-    {0,132335,213001},
-    {1,288976,236309},
-    {2,122058,144921},
-    {3,269207,215594},
-    {4,83594.9,67749.5},
-    {5,286095,209579},
+    {0,1,-132335,213001},
+    {1,1,-288976,236309},
+    {2,1,-122058,144921},
+    {3,1,-269207,215594},
+    {4,1,-83594.9,67749.5},
+    {5,1,-286095,209579},
   },
   // deep = 7
   {
-    {0,-175662,268691},
-    {1,-19020.4,198772},
-    {2,-185938,221830},
-    {3,-38790,125064},
-    {4,-224402,210306},
-    {5,-21901.7,73582.7},
-    {6,-307997,203890},
+    {0,1,175662,268691},
+    {1,1,19020.4,198772},
+    {2,1,185938,221830},
+    {3,1,38790,125064},
+    {4,1,224402,210306},
+    {5,1,21901.7,73582.7},
+    {6,1,307997,203890},
   },
   // deep = 8
   {
-    {0,139032,218714},
-    {1,295673,243593},
-    {2,128755,164834},
-    {3,275903,223845},
-    {4,90291.5,91388.2},
-    {5,292792,214509},
-    {6,6696.57,59081.9},
-    {7,314693,203814},
+    {0,1,-139032,218714},
+    {1,1,-295673,243593},
+    {2,1,-128755,164834},
+    {3,1,-275903,223845},
+    {4,1,-90291.5,91388.2},
+    {5,1,-292792,214509},
+    {6,1,-6696.57,59081.9},
+    {7,1,-314693,203814},
   },
 },
 // move 38
@@ -2515,63 +2515,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-151321,244919},
+    {0,1,151321,244919},
   },
   // deep = 2
   {
-    {0,24203.8,187696},
-    {1,175524,229321},
+    {0,1,-24203.8,187696},
+    {1,1,-175524,229321},
   },
   // deep = 3
   {
-    {0,-132732,254651},
-    {1,18588.9,174588},
-    {2,-156935,220046},
+    {0,1,132732,254651},
+    {1,1,-18588.9,174588},
+    {2,1,156935,220046},
   },
   // deep = 4
   {
-    {0,76753.7,196688},
-    {1,228074,243966},
-    {2,52549.9,115140},
-    {3,209485,226351},
+    {0,1,-76753.7,196688},
+    {1,1,-228074,243966},
+    {2,1,-52549.9,115140},
+    {3,1,-209485,226351},
   },
   // deep = 5
   {
-    {0,-184543,261138},
-    {1,-33222.7,192088},
-    {2,-208747,226262},
-    {3,-51811.6,91549.9},
-    {4,-261297,217153},
+    {0,1,184543,261138},
+    {1,1,33222.7,192088},
+    {2,1,208747,226262},
+    {3,1,51811.6,91549.9},
+    {4,1,261297,217153},
   },
   // deep = 6
   {
-    {0,116875,213509},
-    {1,268195,257561},
-    {2,92670.8,144836},
-    {3,249606,240580},
-    {4,40120.9,86218.9},
-    {5,301418,222380},
+    {0,1,-116875,213509},
+    {1,1,-268195,257561},
+    {2,1,-92670.8,144836},
+    {3,1,-249606,240580},
+    {4,1,-40120.9,86218.9},
+    {5,1,-301418,222380},
   },
   // deep = 7
   {
-    {0,-162343,268881},
-    {1,-11022.1,214013},
-    {2,-186546,236626},
-    {3,-29611,121274},
-    {4,-239096,224246},
-    {5,22200.6,76535.6},
-    {6,-279217,219408},
+    {0,1,162343,268881},
+    {1,1,11022.1,214013},
+    {2,1,186546,236626},
+    {3,1,29611,121274},
+    {4,1,239096,224246},
+    {5,1,-22200.6,76535.6},
+    {6,1,279217,219408},
   },
   // deep = 8
   {
-    {0,152858,226421},
-    {1,304178,276218},
-    {2,128654,168704},
-    {3,285589,256341},
-    {4,76104.1,110463},
-    {5,337401,235078},
-    {6,35983.2,63656.4},
-    {7,315200,223909},
+    {0,1,-152858,226421},
+    {1,1,-304178,276218},
+    {2,1,-128654,168704},
+    {3,1,-285589,256341},
+    {4,1,-76104.1,110463},
+    {5,1,-337401,235078},
+    {6,1,-35983.2,63656.4},
+    {7,1,-315200,223909},
   },
 },
 // move 39
@@ -2581,63 +2581,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-144929,284547},
+    {0,1,144929,284547},
   },
   // deep = 2
   {
-    {0,44279.5,186824},
-    {1,189208,261775},
+    {0,1,-44279.5,186824},
+    {1,1,-189208,261775},
   },
   // deep = 3
   {
-    {0,-126906,292084},
-    {1,18022.7,191448},
-    {2,-171185,246484},
+    {0,1,126906,292084},
+    {1,1,-18022.7,191448},
+    {2,1,171185,246484},
   },
   // deep = 4
   {
-    {0,133849,203509},
-    {1,278777,273211},
-    {2,89569.1,115614},
-    {3,260754,242779},
+    {0,1,-133849,203509},
+    {1,1,-278777,273211},
+    {2,1,-89569.1,115614},
+    {3,1,-260754,242779},
   },
   // deep = 5
   {
-    {0,-138611,302625},
-    {1,6317.54,214365},
-    {2,-182891,254591},
-    {3,-11705.1,113759},
-    {4,-272460,237975},
+    {0,1,138611,302625},
+    {1,1,-6317.54,214365},
+    {2,1,182891,254591},
+    {3,1,11705.1,113759},
+    {4,1,272460,237975},
   },
   // deep = 6
   {
-    {0,136191,222266},
-    {1,281120,283451},
-    {2,91911.6,142291},
-    {3,263097,254152},
-    {4,2342.5,85057.7},
-    {5,274802,236589},
+    {0,1,-136191,222266},
+    {1,1,-281120,283451},
+    {2,1,-91911.6,142291},
+    {3,1,-263097,254152},
+    {4,1,-2342.5,85057.7},
+    {5,1,-274802,236589},
   },
   // deep = 7
   {
-    {0,-148613,315441},
-    {1,-3684.88,239584},
-    {2,-192893,268943},
-    {3,-21707.6,136966},
-    {4,-282462,245347},
-    {5,-10002.4,73062.8},
-    {6,-284805,237750},
+    {0,1,148613,315441},
+    {1,1,3684.88,239584},
+    {2,1,192893,268943},
+    {3,1,21707.6,136966},
+    {4,1,282462,245347},
+    {5,1,10002.4,73062.8},
+    {6,1,284805,237750},
   },
   // deep = 8
   {
-    {0,206403,238837},
-    {1,351331,292530},
-    {2,162123,167650},
-    {3,333309,254264},
-    {4,72554.1,110037},
-    {5,345014,234463},
-    {6,70211.6,67932.4},
-    {7,355016,229346},
+    {0,1,-206403,238837},
+    {1,1,-351331,292530},
+    {2,1,-162123,167650},
+    {3,1,-333309,254264},
+    {4,1,-72554.1,110037},
+    {5,1,-345014,234463},
+    {6,1,-70211.6,67932.4},
+    {7,1,-355016,229346},
   },
 },
 // move 40
@@ -2647,63 +2647,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-156941,306191},
+    {0,1,156941,306191},
   },
   // deep = 2
   {
-    {0,43621.7,224692},
-    {1,200563,281997},
+    {0,1,-43621.7,224692},
+    {1,1,-200563,281997},
   },
   // deep = 3
   {
-    {0,-181094,312412},
-    {1,-24152.8,159004},
-    {2,-224716,258755},
+    {0,1,181094,312412},
+    {1,1,24152.8,159004},
+    {2,1,224716,258755},
   },
   // deep = 4
   {
-    {0,98639.2,249645},
-    {1,255581,305498},
-    {2,55017.5,134238},
-    {3,279733,259989},
+    {0,1,-98639.2,249645},
+    {1,1,-255581,305498},
+    {2,1,-55017.5,134238},
+    {3,1,-279733,259989},
   },
   // deep = 5
   {
-    {0,-153325,329516},
-    {1,3616.76,194975},
-    {2,-196946,267313},
-    {3,27769.6,112047},
-    {4,-251964,251314},
+    {0,1,153325,329516},
+    {1,1,-3616.76,194975},
+    {2,1,196946,267313},
+    {3,1,-27769.6,112047},
+    {4,1,251964,251314},
   },
   // deep = 6
   {
-    {0,128976,270667},
-    {1,285918,318124},
-    {2,85354.8,165221},
-    {3,310071,270632},
-    {4,30337.3,85815.7},
-    {5,282301,252046},
+    {0,1,-128976,270667},
+    {1,1,-285918,318124},
+    {2,1,-85354.8,165221},
+    {3,1,-310071,270632},
+    {4,1,-30337.3,85815.7},
+    {5,1,-282301,252046},
   },
   // deep = 7
   {
-    {0,-193445,337110},
-    {1,-36503.7,226359},
-    {2,-237067,270060},
-    {3,-12350.9,145968},
-    {4,-292084,243161},
-    {5,-40120.5,80284.9},
-    {6,-322422,236890},
+    {0,1,193445,337110},
+    {1,1,36503.7,226359},
+    {2,1,237067,270060},
+    {3,1,12350.9,145968},
+    {4,1,292084,243161},
+    {5,1,40120.5,80284.9},
+    {6,1,322422,236890},
   },
   // deep = 8
   {
-    {0,219936,282487},
-    {1,376877,331690},
-    {2,176314,185665},
-    {3,401030,284043},
-    {4,121297,113634},
-    {5,373261,259889},
-    {6,90959.5,73136.9},
-    {7,413381,238646},
+    {0,1,-219936,282487},
+    {1,1,-376877,331690},
+    {2,1,-176314,185665},
+    {3,1,-401030,284043},
+    {4,1,-121297,113634},
+    {5,1,-373261,259889},
+    {6,1,-90959.5,73136.9},
+    {7,1,-413381,238646},
   },
 },
 // move 41
@@ -2713,63 +2713,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-186270,311949},
+    {0,1,186270,311949},
   },
   // deep = 2
   {
-    {0,103811,221562},
-    {1,290081,310575},
+    {0,1,-103811,221562},
+    {1,1,-290081,310575},
   },
   // deep = 3
   {
-    {0,-150391,338156},
-    {1,35879.2,199283},
-    {2,-254202,278684},
+    {0,1,150391,338156},
+    {1,1,-35879.2,199283},
+    {2,1,254202,278684},
   },
   // deep = 4
   {
-    {0,113807,251348},
-    {1,300077,314885},
-    {2,9996,133372},
-    {3,264198,270203},
+    {0,1,-113807,251348},
+    {1,1,-300077,314885},
+    {2,1,-9996,133372},
+    {3,1,-264198,270203},
   },
   // deep = 5
   {
-    {0,-142464,352044},
-    {1,43806.2,228594},
-    {2,-246275,286134},
-    {3,7927.03,108685},
-    {4,-256271,262817},
+    {0,1,142464,352044},
+    {1,1,-43806.2,228594},
+    {2,1,246275,286134},
+    {3,1,-7927.03,108685},
+    {4,1,256271,262817},
   },
   // deep = 6
   {
-    {0,171935,279637},
-    {1,358205,320896},
-    {2,68123.8,165827},
-    {3,322326,267111},
-    {4,58127.8,84742.7},
-    {5,314399,253474},
+    {0,1,-171935,279637},
+    {1,1,-358205,320896},
+    {2,1,-68123.8,165827},
+    {3,1,-322326,267111},
+    {4,1,-58127.8,84742.7},
+    {5,1,-314399,253474},
   },
   // deep = 7
   {
-    {0,-202941,365045},
-    {1,-16671,252833},
-    {2,-306752,298004},
-    {3,-52550.2,143783},
-    {4,-316748,268908},
-    {5,-60477.2,83969},
-    {6,-374876,253137},
+    {0,1,202941,365045},
+    {1,1,16671,252833},
+    {2,1,306752,298004},
+    {3,1,52550.2,143783},
+    {4,1,316748,268908},
+    {5,1,60477.2,83969},
+    {6,1,374876,253137},
   },
   // deep = 8
   {
-    {0,198013,296702},
-    {1,384283,329664},
-    {2,94201.6,193529},
-    {3,348404,273400},
-    {4,84205.6,117467},
-    {5,340477,254323},
-    {6,26077.8,71123.8},
-    {7,400954,245928},
+    {0,1,-198013,296702},
+    {1,1,-384283,329664},
+    {2,1,-94201.6,193529},
+    {3,1,-348404,273400},
+    {4,1,-84205.6,117467},
+    {5,1,-340477,254323},
+    {6,1,-26077.8,71123.8},
+    {7,1,-400954,245928},
   },
 },
 // move 42
@@ -2779,63 +2779,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-230405,348493},
+    {0,1,230405,348493},
   },
   // deep = 2
   {
-    {0,69103,245913},
-    {1,299508,329330},
+    {0,1,-69103,245913},
+    {1,1,-299508,329330},
   },
   // deep = 3
   {
-    {0,-159810,362007},
-    {1,70594.7,197357},
-    {2,-228913,294218},
+    {0,1,159810,362007},
+    {1,1,-70594.7,197357},
+    {2,1,228913,294218},
   },
   // deep = 4
   {
-    {0,115580,276722},
-    {1,345985,338670},
-    {2,46477.3,140629},
-    {3,275391,291696},
+    {0,1,-115580,276722},
+    {1,1,-345985,338670},
+    {2,1,-46477.3,140629},
+    {3,1,-275391,291696},
   },
   // deep = 5
   {
-    {0,-172778,367643},
-    {1,57627.5,236718},
-    {2,-241881,283201},
-    {3,-12967.2,117918},
-    {4,-288358,264036},
+    {0,1,172778,367643},
+    {1,1,-57627.5,236718},
+    {2,1,241881,283201},
+    {3,1,12967.2,117918},
+    {4,1,288358,264036},
   },
   // deep = 6
   {
-    {0,199739,298554},
-    {1,430144,354171},
-    {2,130636,179059},
-    {3,359550,294882},
-    {4,84159,98272.3},
-    {5,372517,262709},
+    {0,1,-199739,298554},
+    {1,1,-430144,354171},
+    {2,1,-130636,179059},
+    {3,1,-359550,294882},
+    {4,1,-84159,98272.3},
+    {5,1,-372517,262709},
   },
   // deep = 7
   {
-    {0,-159123,381318},
-    {1,71282.2,270480},
-    {2,-228226,299550},
-    {3,687.491,156476},
-    {4,-274703,270082},
-    {5,13654.7,96122.2},
-    {6,-358862,255597},
+    {0,1,159123,381318},
+    {1,1,-71282.2,270480},
+    {2,1,228226,299550},
+    {3,1,-687.491,156476},
+    {4,1,274703,270082},
+    {5,1,-13654.7,96122.2},
+    {6,1,358862,255597},
   },
   // deep = 8
   {
-    {0,299571,311249},
-    {1,529976,362604},
-    {2,230468,197631},
-    {3,459382,300338},
-    {4,183991,124406},
-    {5,472349,264094},
-    {6,99832.1,72697.3},
-    {7,458694,251779},
+    {0,1,-299571,311249},
+    {1,1,-529976,362604},
+    {2,1,-230468,197631},
+    {3,1,-459382,300338},
+    {4,1,-183991,124406},
+    {5,1,-472349,264094},
+    {6,1,-99832.1,72697.3},
+    {7,1,-458694,251779},
   },
 },
 // move 43
@@ -2845,63 +2845,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-264024,374980},
+    {0,1,264024,374980},
   },
   // deep = 2
   {
-    {0,13383.6,247718},
-    {1,277407,341359},
+    {0,1,-13383.6,247718},
+    {1,1,-277407,341359},
   },
   // deep = 3
   {
-    {0,-215750,386655},
-    {1,48273.5,211133},
-    {2,-229134,315601},
+    {0,1,215750,386655},
+    {1,1,-48273.5,211133},
+    {2,1,229134,315601},
   },
   // deep = 4
   {
-    {0,85439.9,279265},
-    {1,349463,342767},
-    {2,72056.3,156518},
-    {3,301190,297567},
+    {0,1,-85439.9,279265},
+    {1,1,-349463,342767},
+    {2,1,-72056.3,156518},
+    {3,1,-301190,297567},
   },
   // deep = 5
   {
-    {0,-260504,407782},
-    {1,3519.71,242922},
-    {2,-273888,317661},
-    {3,-44753.8,131230},
-    {4,-345944,288560},
+    {0,1,260504,407782},
+    {1,1,-3519.71,242922},
+    {2,1,273888,317661},
+    {3,1,44753.8,131230},
+    {4,1,345944,288560},
   },
   // deep = 6
   {
-    {0,89741.3,314016},
-    {1,353765,355094},
-    {2,76357.6,188390},
-    {3,305491,302794},
-    {4,4301.36,111081},
-    {5,350245,277052},
+    {0,1,-89741.3,314016},
+    {1,1,-353765,355094},
+    {2,1,-76357.6,188390},
+    {3,1,-305491,302794},
+    {4,1,-4301.36,111081},
+    {5,1,-350245,277052},
   },
   // deep = 7
   {
-    {0,-324222,419020},
-    {1,-60198.7,264998},
-    {2,-337606,325323},
-    {3,-108472,162805},
-    {4,-409662,288459},
-    {5,-63718.4,93068.6},
-    {6,-413964,266161},
+    {0,1,324222,419020},
+    {1,1,60198.7,264998},
+    {2,1,337606,325323},
+    {3,1,108472,162805},
+    {4,1,409662,288459},
+    {5,1,63718.4,93068.6},
+    {6,1,413964,266161},
   },
   // deep = 8
   {
-    {0,192363,325932},
-    {1,456386,355622},
-    {2,178979,209443},
-    {3,408113,302874},
-    {4,106923,135220},
-    {5,452867,270480},
-    {6,102621,79412.2},
-    {7,516585,256551},
+    {0,1,-192363,325932},
+    {1,1,-456386,355622},
+    {2,1,-178979,209443},
+    {3,1,-408113,302874},
+    {4,1,-106923,135220},
+    {5,1,-452867,270480},
+    {6,1,-102621,79412.2},
+    {7,1,-516585,256551},
   },
 },
 // move 44
@@ -2911,63 +2911,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-187774,389875},
+    {0,1,187774,389875},
   },
   // deep = 2
   {
-    {0,94430.2,277065},
-    {1,282204,373984},
+    {0,1,-94430.2,277065},
+    {1,1,-282204,373984},
   },
   // deep = 3
   {
-    {0,-160730,385021},
-    {1,27044.1,232458},
-    {2,-255160,312575},
+    {0,1,160730,385021},
+    {1,1,-27044.1,232458},
+    {2,1,255160,312575},
   },
   // deep = 4
   {
-    {0,202068,317833},
-    {1,389842,390292},
-    {2,107638,167380},
-    {3,362798,311446},
+    {0,1,-202068,317833},
+    {1,1,-389842,390292},
+    {2,1,-107638,167380},
+    {3,1,-362798,311446},
   },
   // deep = 5
   {
-    {0,-122285,405913},
-    {1,65489.2,285389},
-    {2,-216715,319765},
-    {3,38445.1,154829},
-    {4,-324353,292070},
+    {0,1,122285,405913},
+    {1,1,-65489.2,285389},
+    {2,1,216715,319765},
+    {3,1,-38445.1,154829},
+    {4,1,324353,292070},
   },
   // deep = 6
   {
-    {0,295680,329958},
-    {1,483454,397431},
-    {2,201250,198455},
-    {3,456410,309897},
-    {4,93611.8,118560},
-    {5,417965,277804},
+    {0,1,-295680,329958},
+    {1,1,-483454,397431},
+    {2,1,-201250,198455},
+    {3,1,-456410,309897},
+    {4,1,-93611.8,118560},
+    {5,1,-417965,277804},
   },
   // deep = 7
   {
-    {0,-177337,412758},
-    {1,10437,311575},
-    {2,-271767,316255},
-    {3,-16607.1,175168},
-    {4,-379405,281446},
-    {5,-55052.2,95809.8},
-    {6,-473017,261862},
+    {0,1,177337,412758},
+    {1,1,-10437,311575},
+    {2,1,271767,316255},
+    {3,1,16607.1,175168},
+    {4,1,379405,281446},
+    {5,1,55052.2,95809.8},
+    {6,1,473017,261862},
   },
   // deep = 8
   {
-    {0,279283,355980},
-    {1,467057,407946},
-    {2,184853,227551},
-    {3,440013,316376},
-    {4,77214.8,147666},
-    {5,401568,276857},
-    {6,-16397,87273.7},
-    {7,456620,254433},
+    {0,1,-279283,355980},
+    {1,1,-467057,407946},
+    {2,1,-184853,227551},
+    {3,1,-440013,316376},
+    {4,1,-77214.8,147666},
+    {5,1,-401568,276857},
+    {6,1,16397,87273.7},
+    {7,1,-456620,254433},
   },
 },
 // move 45
@@ -2977,63 +2977,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-201326,400477},
+    {0,1,201326,400477},
   },
   // deep = 2
   {
-    {0,112639,296665},
-    {1,313964,370924},
+    {0,1,-112639,296665},
+    {1,1,-313964,370924},
   },
   // deep = 3
   {
-    {0,-197004,413071},
-    {1,4322.15,239899},
-    {2,-309642,336076},
+    {0,1,197004,413071},
+    {1,1,-4322.15,239899},
+    {2,1,309642,336076},
   },
   // deep = 4
   {
-    {0,138823,333498},
-    {1,340149,383211},
-    {2,26184.6,193160},
-    {3,335827,316968},
+    {0,1,-138823,333498},
+    {1,1,-340149,383211},
+    {2,1,-26184.6,193160},
+    {3,1,-335827,316968},
   },
   // deep = 5
   {
-    {0,-251255,428585},
-    {1,-49929.3,285415},
-    {2,-363894,334060},
-    {3,-54251.4,153659},
-    {4,-390078,294357},
+    {0,1,251255,428585},
+    {1,1,49929.3,285415},
+    {2,1,363894,334060},
+    {3,1,54251.4,153659},
+    {4,1,390078,294357},
   },
   // deep = 6
   {
-    {0,223293,361135},
-    {1,424619,388177},
-    {2,110655,225120},
-    {3,420297,314595},
-    {4,84470,120486},
-    {5,474548,283315},
+    {0,1,-223293,361135},
+    {1,1,-424619,388177},
+    {2,1,-110655,225120},
+    {3,1,-420297,314595},
+    {4,1,-84470,120486},
+    {5,1,-474548,283315},
   },
   // deep = 7
   {
-    {0,-184957,443754},
-    {1,16368.7,314584},
-    {2,-297596,342355},
-    {3,12046.6,186261},
-    {4,-323780,287319},
-    {5,66298,111333},
-    {6,-408250,262562},
+    {0,1,184957,443754},
+    {1,1,-16368.7,314584},
+    {2,1,297596,342355},
+    {3,1,-12046.6,186261},
+    {4,1,323780,287319},
+    {5,1,-66298,111333},
+    {6,1,408250,262562},
   },
   // deep = 8
   {
-    {0,340175,384529},
-    {1,541501,408704},
-    {2,227536,253812},
-    {3,537179,332118},
-    {4,201352,147351},
-    {5,591430,290180},
-    {6,116882,106248},
-    {7,525132,262274},
+    {0,1,-340175,384529},
+    {1,1,-541501,408704},
+    {2,1,-227536,253812},
+    {3,1,-537179,332118},
+    {4,1,-201352,147351},
+    {5,1,-591430,290180},
+    {6,1,-116882,106248},
+    {7,1,-525132,262274},
   },
 },
 // move 46
@@ -3043,63 +3043,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-265285,423296},
+    {0,1,265285,423296},
   },
   // deep = 2
   {
-    {0,113099,318776},
-    {1,378385,387746},
+    {0,1,-113099,318776},
+    {1,1,-378385,387746},
   },
   // deep = 3
   {
-    {0,-166973,431050},
-    {1,98312.7,259014},
-    {2,-280072,327451},
+    {0,1,166973,431050},
+    {1,1,-98312.7,259014},
+    {2,1,280072,327451},
   },
   // deep = 4
   {
-    {0,241721,359519},
-    {1,507006,394535},
-    {2,128622,185624},
-    {3,408694,315883},
+    {0,1,-241721,359519},
+    {1,1,-507006,394535},
+    {2,1,-128622,185624},
+    {3,1,-408694,315883},
   },
   // deep = 5
   {
-    {0,-208003,435921},
-    {1,57282.6,294063},
-    {2,-321102,323891},
-    {3,-41030.2,157982},
-    {4,-449724,297004},
+    {0,1,208003,435921},
+    {1,1,-57282.6,294063},
+    {2,1,321102,323891},
+    {3,1,41030.2,157982},
+    {4,1,449724,297004},
   },
   // deep = 6
   {
-    {0,213784,381888},
-    {1,479069,402963},
-    {2,100684,221082},
-    {3,380756,316827},
-    {4,-27937.5,135581},
-    {5,421786,278393},
+    {0,1,-213784,381888},
+    {1,1,-479069,402963},
+    {2,1,-100684,221082},
+    {3,1,-380756,316827},
+    {4,1,27937.5,135581},
+    {5,1,-421786,278393},
   },
   // deep = 7
   {
-    {0,-268939,457529},
-    {1,-3653.63,323740},
-    {2,-382038,333658},
-    {3,-101966,185822},
-    {4,-510660,296343},
-    {5,-60936.2,126425},
-    {6,-482723,266824},
+    {0,1,268939,457529},
+    {1,1,3653.63,323740},
+    {2,1,382038,333658},
+    {3,1,101966,185822},
+    {4,1,510660,296343},
+    {5,1,60936.2,126425},
+    {6,1,482723,266824},
   },
   // deep = 8
   {
-    {0,229664,399989},
-    {1,494950,415937},
-    {2,116565,251184},
-    {3,396637,324162},
-    {4,-12056.6,161709},
-    {5,437667,281047},
-    {6,15880.9,103111},
-    {7,498603,262236},
+    {0,1,-229664,399989},
+    {1,1,-494950,415937},
+    {2,1,-116565,251184},
+    {3,1,-396637,324162},
+    {4,1,12056.6,161709},
+    {5,1,-437667,281047},
+    {6,1,-15880.9,103111},
+    {7,1,-498603,262236},
   },
 },
 // move 47
@@ -3109,63 +3109,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-282769,463061},
+    {0,1,282769,463061},
   },
   // deep = 2
   {
-    {0,77054.2,358532},
-    {1,359823,392074},
+    {0,1,-77054.2,358532},
+    {1,1,-359823,392074},
   },
   // deep = 3
   {
-    {0,-274241,459734},
-    {1,8527.42,288413},
-    {2,-351295,341392},
+    {0,1,274241,459734},
+    {1,1,-8527.42,288413},
+    {2,1,351295,341392},
   },
   // deep = 4
   {
-    {0,209838,385550},
-    {1,492606,419397},
-    {2,132784,220660},
-    {3,484079,324280},
+    {0,1,-209838,385550},
+    {1,1,-492606,419397},
+    {2,1,-132784,220660},
+    {3,1,-484079,324280},
   },
   // deep = 5
   {
-    {0,-187036,468429},
-    {1,95732.5,324846},
-    {2,-264090,346322},
-    {3,87205.1,194061},
-    {4,-396874,293957},
+    {0,1,187036,468429},
+    {1,1,-95732.5,324846},
+    {2,1,264090,346322},
+    {3,1,-87205.1,194061},
+    {4,1,396874,293957},
   },
   // deep = 6
   {
-    {0,318137,394491},
-    {1,600906,424922},
-    {2,241083,238607},
-    {3,592378,329940},
-    {4,108299,158242},
-    {5,505173,283596},
+    {0,1,-318137,394491},
+    {1,1,-600906,424922},
+    {2,1,-241083,238607},
+    {3,1,-592378,329940},
+    {4,1,-108299,158242},
+    {5,1,-505173,283596},
   },
   // deep = 7
   {
-    {0,-133717,469923},
-    {1,149052,347851},
-    {2,-210771,345945},
-    {3,140525,214214},
-    {4,-343554,288586},
-    {5,53319.5,138206},
-    {6,-451854,267033},
+    {0,1,133717,469923},
+    {1,1,-149052,347851},
+    {2,1,210771,345945},
+    {3,1,-140525,214214},
+    {4,1,343554,288586},
+    {5,1,-53319.5,138206},
+    {6,1,451854,267033},
   },
   // deep = 8
   {
-    {0,391036,408442},
-    {1,673805,423202},
-    {2,313982,265741},
-    {3,665277,324311},
-    {4,181198,180180},
-    {5,578072,275389},
-    {6,72899,134072},
-    {7,524753,249463},
+    {0,1,-391036,408442},
+    {1,1,-673805,423202},
+    {2,1,-313982,265741},
+    {3,1,-665277,324311},
+    {4,1,-181198,180180},
+    {5,1,-578072,275389},
+    {6,1,-72899,134072},
+    {7,1,-524753,249463},
   },
 },
 // move 48
@@ -3175,63 +3175,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-280963,451837},
+    {0,1,280963,451837},
   },
   // deep = 2
   {
-    {0,179309,392498},
-    {1,460272,444146},
+    {0,1,-179309,392498},
+    {1,1,-460272,444146},
   },
   // deep = 3
   {
-    {0,-269123,464444},
-    {1,11840.3,317143},
-    {2,-448432,369946},
+    {0,1,269123,464444},
+    {1,1,-11840.3,317143},
+    {2,1,448432,369946},
   },
   // deep = 4
   {
-    {0,170475,413294},
-    {1,451438,456364},
-    {2,-8833.85,260449},
-    {3,439598,337580},
+    {0,1,-170475,413294},
+    {1,1,-451438,456364},
+    {2,1,8833.85,260449},
+    {3,1,-439598,337580},
   },
   // deep = 5
   {
-    {0,-314554,477556},
-    {1,-33590.9,356298},
-    {2,-493863,376739},
-    {3,-45431.2,199639},
-    {4,-485029,312124},
+    {0,1,314554,477556},
+    {1,1,33590.9,356298},
+    {2,1,493863,376739},
+    {3,1,45431.2,199639},
+    {4,1,485029,312124},
   },
   // deep = 6
   {
-    {0,161189,436088},
-    {1,442152,460556},
-    {2,-18120.4,283041},
-    {3,430312,332893},
-    {4,-9286.53,168483},
-    {5,475743,279818},
+    {0,1,-161189,436088},
+    {1,1,-442152,460556},
+    {2,1,18120.4,283041},
+    {3,1,-430312,332893},
+    {4,1,9286.53,168483},
+    {5,1,-475743,279818},
   },
   // deep = 7
   {
-    {0,-329259,479221},
-    {1,-48295.8,384399},
-    {2,-508568,364427},
-    {3,-60136.1,234217},
-    {4,-499734,293995},
-    {5,-14704.9,157976},
-    {6,-490448,252250},
+    {0,1,329259,479221},
+    {1,1,48295.8,384399},
+    {2,1,508568,364427},
+    {3,1,60136.1,234217},
+    {4,1,499734,293995},
+    {5,1,14704.9,157976},
+    {6,1,490448,252250},
   },
   // deep = 8
   {
-    {0,242097,440570},
-    {1,523060,469041},
-    {2,62788,304998},
-    {3,511220,344529},
-    {4,71621.9,196023},
-    {5,556651,295671},
-    {6,80908.4,136796},
-    {7,571356,255061},
+    {0,1,-242097,440570},
+    {1,1,-523060,469041},
+    {2,1,-62788,304998},
+    {3,1,-511220,344529},
+    {4,1,-71621.9,196023},
+    {5,1,-556651,295671},
+    {6,1,-80908.4,136796},
+    {7,1,-571356,255061},
   },
 },
 // move 49
@@ -3241,63 +3241,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-376577,523665},
+    {0,1,376577,523665},
   },
   // deep = 2
   {
-    {0,196090,410053},
-    {1,572667,462195},
+    {0,1,-196090,410053},
+    {1,1,-572667,462195},
   },
   // deep = 3
   {
-    {0,-212874,516068},
-    {1,163703,332527},
-    {2,-408964,361038},
+    {0,1,212874,516068},
+    {1,1,-163703,332527},
+    {2,1,408964,361038},
   },
   // deep = 4
   {
-    {0,330143,458414},
-    {1,706720,473845},
-    {2,134053,256166},
-    {3,543017,334111},
+    {0,1,-330143,458414},
+    {1,1,-706720,473845},
+    {2,1,-134053,256166},
+    {3,1,-543017,334111},
   },
   // deep = 5
   {
-    {0,-143302,535289},
-    {1,233275,386523},
-    {2,-339392,358841},
-    {3,69572.4,220059},
-    {4,-473445,305097},
+    {0,1,143302,535289},
+    {1,1,-233275,386523},
+    {2,1,339392,358841},
+    {3,1,-69572.4,220059},
+    {4,1,473445,305097},
   },
   // deep = 6
   {
-    {0,383698,467768},
-    {1,760275,467588},
-    {2,187608,270034},
-    {3,596572,328078},
-    {4,53555.1,186131},
-    {5,527000,279220},
+    {0,1,-383698,467768},
+    {1,1,-760275,467588},
+    {2,1,-187608,270034},
+    {3,1,-596572,328078},
+    {4,1,-53555.1,186131},
+    {5,1,-527000,279220},
   },
   // deep = 7
   {
-    {0,-168907,551107},
-    {1,207671,418810},
-    {2,-364996,387293},
-    {3,43967.7,270581},
-    {4,-499049,327028},
-    {5,-25604.7,195727},
-    {6,-552605,278030},
+    {0,1,168907,551107},
+    {1,1,-207671,418810},
+    {2,1,364996,387293},
+    {3,1,-43967.7,270581},
+    {4,1,499049,327028},
+    {5,1,25604.7,195727},
+    {6,1,552605,278030},
   },
   // deep = 8
   {
-    {0,459876,487352},
-    {1,836453,484578},
-    {2,263786,309977},
-    {3,672750,354664},
-    {4,129733,235329},
-    {5,603178,297036},
-    {6,76177.9,179651},
-    {7,628782,265490},
+    {0,1,-459876,487352},
+    {1,1,-836453,484578},
+    {2,1,-263786,309977},
+    {3,1,-672750,354664},
+    {4,1,-129733,235329},
+    {5,1,-603178,297036},
+    {6,1,-76177.9,179651},
+    {7,1,-628782,265490},
   },
 },
 // move 50
@@ -3307,63 +3307,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-453326,536095},
+    {0,1,453326,536095},
   },
   // deep = 2
   {
-    {0,56338.2,439482},
-    {1,509664,495154},
+    {0,1,-56338.2,439482},
+    {1,1,-509664,495154},
   },
   // deep = 3
   {
-    {0,-447475,562941},
-    {1,5850.96,387727},
-    {2,-503813,407569},
+    {0,1,447475,562941},
+    {1,1,-5850.96,387727},
+    {2,1,503813,407569},
   },
   // deep = 4
   {
-    {0,95977.3,506927},
-    {1,549303,512012},
-    {2,39639.1,313391},
-    {3,543452,377214},
+    {0,1,-95977.3,506927},
+    {1,1,-549303,512012},
+    {2,1,-39639.1,313391},
+    {3,1,-543452,377214},
   },
   // deep = 5
   {
-    {0,-412834,573028},
-    {1,40491.1,423959},
-    {2,-469173,432137},
-    {3,34640.1,262541},
-    {4,-508812,350495},
+    {0,1,412834,573028},
+    {1,1,-40491.1,423959},
+    {2,1,469173,432137},
+    {3,1,-34640.1,262541},
+    {4,1,508812,350495},
   },
   // deep = 6
   {
-    {0,179205,538855},
-    {1,632531,512410},
-    {2,122867,360742},
-    {3,626680,382491},
-    {4,83228.2,235168},
-    {5,592040,311919},
+    {0,1,-179205,538855},
+    {1,1,-632531,512410},
+    {2,1,-122867,360742},
+    {3,1,-626680,382491},
+    {4,1,-83228.2,235168},
+    {5,1,-592040,311919},
   },
   // deep = 7
   {
-    {0,-442330,594403},
-    {1,10995.1,450491},
-    {2,-498669,440782},
-    {3,5144.16,307726},
-    {4,-538308,353660},
-    {5,-29496,218988},
-    {6,-621536,288161},
+    {0,1,442330,594403},
+    {1,1,-10995.1,450491},
+    {2,1,498669,440782},
+    {3,1,-5144.16,307726},
+    {4,1,538308,353660},
+    {5,1,29496,218988},
+    {6,1,621536,288161},
   },
   // deep = 8
   {
-    {0,278332,554104},
-    {1,731657,526238},
-    {2,221993,382457},
-    {3,725806,390316},
-    {4,182354,268607},
-    {5,691166,317236},
-    {6,99126.1,194328},
-    {7,720662,278849},
+    {0,1,-278332,554104},
+    {1,1,-731657,526238},
+    {2,1,-221993,382457},
+    {3,1,-725806,390316},
+    {4,1,-182354,268607},
+    {5,1,-691166,317236},
+    {6,1,-99126.1,194328},
+    {7,1,-720662,278849},
   },
 },
 // move 51
@@ -3373,63 +3373,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-376043,584051},
+    {0,1,376043,584051},
   },
   // deep = 2
   {
-    {0,241226,559412},
-    {1,617269,575017},
+    {0,1,-241226,559412},
+    {1,1,-617269,575017},
   },
   // deep = 3
   {
-    {0,-244285,610267},
-    {1,131757,450929},
-    {2,-485511,434822},
+    {0,1,244285,610267},
+    {1,1,-131757,450929},
+    {2,1,485511,434822},
   },
   // deep = 4
   {
-    {0,319493,587160},
-    {1,695536,579017},
-    {2,78267.3,349457},
-    {3,563779,395272},
+    {0,1,-319493,587160},
+    {1,1,-695536,579017},
+    {2,1,-78267.3,349457},
+    {3,1,-563779,395272},
   },
   // deep = 5
   {
-    {0,-224017,623154},
-    {1,152026,515651},
-    {2,-465243,454083},
-    {3,20268.7,301118},
-    {4,-543510,346659},
+    {0,1,224017,623154},
+    {1,1,-152026,515651},
+    {2,1,465243,454083},
+    {3,1,-20268.7,301118},
+    {4,1,543510,346659},
   },
   // deep = 6
   {
-    {0,387557,620482},
-    {1,763599,598958},
-    {2,146331,399891},
-    {3,631842,424571},
-    {4,68063.3,258007},
-    {5,611573,345540},
+    {0,1,-387557,620482},
+    {1,1,-763599,598958},
+    {2,1,-146331,399891},
+    {3,1,-631842,424571},
+    {4,1,-68063.3,258007},
+    {5,1,-611573,345540},
   },
   // deep = 7
   {
-    {0,-192734,635294},
-    {1,183309,537316},
-    {2,-433960,461235},
-    {3,51551.7,345615},
-    {4,-512227,343845},
-    {5,31283.1,249966},
-    {6,-580290,324259},
+    {0,1,192734,635294},
+    {1,1,-183309,537316},
+    {2,1,433960,461235},
+    {3,1,-51551.7,345615},
+    {4,1,512227,343845},
+    {5,1,-31283.1,249966},
+    {6,1,580290,324259},
   },
   // deep = 8
   {
-    {0,218682,648388},
-    {1,594724,625864},
-    {2,-22544.5,437182},
-    {3,462967,440945},
-    {4,-100812,291689},
-    {5,442698,361282},
-    {6,-168875,227397},
-    {7,411415,313520},
+    {0,1,-218682,648388},
+    {1,1,-594724,625864},
+    {2,1,22544.5,437182},
+    {3,1,-462967,440945},
+    {4,1,100812,291689},
+    {5,1,-442698,361282},
+    {6,1,168875,227397},
+    {7,1,-411415,313520},
   },
 },
 // move 52
@@ -3439,63 +3439,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-487172,660228},
+    {0,1,487172,660228},
   },
   // deep = 2
   {
-    {0,100560,590213},
-    {1,587732,555540},
+    {0,1,-100560,590213},
+    {1,1,-587732,555540},
   },
   // deep = 3
   {
-    {0,-419517,684489},
-    {1,67654.2,480013},
-    {2,-520077,463762},
+    {0,1,419517,684489},
+    {1,1,-67654.2,480013},
+    {2,1,520077,463762},
   },
   // deep = 4
   {
-    {0,154797,642468},
-    {1,641969,607012},
-    {2,54237,399528},
-    {3,574314,436952},
+    {0,1,-154797,642468},
+    {1,1,-641969,607012},
+    {2,1,-54237,399528},
+    {3,1,-574314,436952},
   },
   // deep = 5
   {
-    {0,-397555,723306},
-    {1,89616.7,562803},
-    {2,-498115,504436},
-    {3,21962.4,342745},
-    {4,-552352,417726},
+    {0,1,397555,723306},
+    {1,1,-89616.7,562803},
+    {2,1,498115,504436},
+    {3,1,-21962.4,342745},
+    {4,1,552352,417726},
   },
   // deep = 6
   {
-    {0,184066,694163},
-    {1,671238,642352},
-    {2,83506.3,451786},
-    {3,603584,446801},
-    {4,29269.3,310360},
-    {5,581621,378085},
+    {0,1,-184066,694163},
+    {1,1,-671238,642352},
+    {2,1,-83506.3,451786},
+    {3,1,-603584,446801},
+    {4,1,-29269.3,310360},
+    {5,1,-581621,378085},
   },
   // deep = 7
   {
-    {0,-153897,755333},
-    {1,333275,598567},
-    {2,-254457,523555},
-    {3,265620,392239},
-    {4,-308694,435401},
-    {5,243658,272663},
-    {6,-337963,355301},
+    {0,1,153897,755333},
+    {1,1,-333275,598567},
+    {2,1,254457,523555},
+    {3,1,-265620,392239},
+    {4,1,308694,435401},
+    {5,1,-243658,272663},
+    {6,1,337963,355301},
   },
   // deep = 8
   {
-    {0,270258,696743},
-    {1,757430,645314},
-    {2,169698,478293},
-    {3,689776,474869},
-    {4,115461,374544},
-    {5,667813,397658},
-    {6,86192,265040},
-    {7,424155,366993},
+    {0,1,-270258,696743},
+    {1,1,-757430,645314},
+    {2,1,-169698,478293},
+    {3,1,-689776,474869},
+    {4,1,-115461,374544},
+    {5,1,-667813,397658},
+    {6,1,-86192,265040},
+    {7,1,-424155,366993},
   },
 },
 // move 53
@@ -3505,63 +3505,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-548319,712946},
+    {0,1,548319,712946},
   },
   // deep = 2
   {
-    {0,86865.6,692394},
-    {1,635185,619649},
+    {0,1,-86865.6,692394},
+    {1,1,-635185,619649},
   },
   // deep = 3
   {
-    {0,-449523,825007},
-    {1,98796.7,542331},
-    {2,-536388,549691},
+    {0,1,449523,825007},
+    {1,1,-98796.7,542331},
+    {2,1,536388,549691},
   },
   // deep = 4
   {
-    {0,118280,761551},
-    {1,666599,665706},
-    {2,31414.4,464769},
-    {3,567803,510214},
+    {0,1,-118280,761551},
+    {1,1,-666599,665706},
+    {2,1,-31414.4,464769},
+    {3,1,-567803,510214},
   },
   // deep = 5
   {
-    {0,-437456,796535},
-    {1,110863,591210},
-    {2,-524322,564238},
-    {3,12066.3,391608},
-    {4,-555736,442746},
+    {0,1,437456,796535},
+    {1,1,-110863,591210},
+    {2,1,524322,564238},
+    {3,1,-12066.3,391608},
+    {4,1,555736,442746},
   },
   // deep = 6
   {
-    {0,-56249.6,774313},
-    {1,492070,660704},
-    {2,-143115,516439},
-    {3,393273,519385},
-    {4,-174530,362467},
-    {5,381207,408696},
+    {0,1,56249.6,774313},
+    {1,1,-492070,660704},
+    {2,1,143115,516439},
+    {3,1,-393273,519385},
+    {4,1,174530,362467},
+    {5,1,-381207,408696},
   },
   // deep = 7
   {
-    {0,-480870,840077},
-    {1,67449.4,644547},
-    {2,-567736,627870},
-    {3,-31347.3,466670},
-    {4,-599150,513649},
-    {5,-43413.6,340521},
-    {6,-424620,426612},
+    {0,1,480870,840077},
+    {1,1,-67449.4,644547},
+    {2,1,567736,627870},
+    {3,1,31347.3,466670},
+    {4,1,599150,513649},
+    {5,1,43413.6,340521},
+    {6,1,424620,426612},
   },
   // deep = 8
   {
-    {0,-65142.7,829626},
-    {1,483177,695107},
-    {2,-152008,581563},
-    {3,384380,550963},
-    {4,-183423,433201},
-    {5,372314,436080},
-    {6,-8893.12,330153},
-    {7,415727,409196},
+    {0,1,65142.7,829626},
+    {1,1,-483177,695107},
+    {2,1,152008,581563},
+    {3,1,-384380,550963},
+    {4,1,183423,433201},
+    {5,1,-372314,436080},
+    {6,1,8893.12,330153},
+    {7,1,-415727,409196},
   },
 },
 // move 54
@@ -3571,63 +3571,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-543938,740739},
+    {0,1,543938,740739},
   },
   // deep = 2
   {
-    {0,120204,749261},
-    {1,664141,654057},
+    {0,1,-120204,749261},
+    {1,1,-664141,654057},
   },
   // deep = 3
   {
-    {0,-401440,859801},
-    {1,142498,627632},
-    {2,-521643,612774},
+    {0,1,401440,859801},
+    {1,1,-142498,627632},
+    {2,1,521643,612774},
   },
   // deep = 4
   {
-    {0,186651,789888},
-    {1,730589,735073},
-    {2,66447.5,494142},
-    {3,588091,534673},
+    {0,1,-186651,789888},
+    {1,1,-730589,735073},
+    {2,1,-66447.5,494142},
+    {3,1,-588091,534673},
   },
   // deep = 5
   {
-    {0,-190483,869478},
-    {1,353454,698218},
-    {2,-310687,638236},
-    {3,210956,477662},
-    {4,-377134,491081},
+    {0,1,190483,869478},
+    {1,1,-353454,698218},
+    {2,1,310687,638236},
+    {3,1,-210956,477662},
+    {4,1,377134,491081},
   },
   // deep = 6
   {
-    {0,260874,860487},
-    {1,804812,775835},
-    {2,140671,575025},
-    {3,662314,603802},
-    {4,74223.1,409906},
-    {5,451358,489537},
+    {0,1,-260874,860487},
+    {1,1,-804812,775835},
+    {2,1,-140671,575025},
+    {3,1,-662314,603802},
+    {4,1,-74223.1,409906},
+    {5,1,-451358,489537},
   },
   // deep = 7
   {
-    {0,-145543,863981},
-    {1,398395,731080},
-    {2,-265746,634978},
-    {3,255897,525355},
-    {4,-332194,471687},
-    {5,44940.6,380369},
-    {6,-406417,434391},
+    {0,1,145543,863981},
+    {1,1,-398395,731080},
+    {2,1,265746,634978},
+    {3,1,-255897,525355},
+    {4,1,332194,471687},
+    {5,1,-44940.6,380369},
+    {6,1,406417,434391},
   },
   // deep = 8
   {
-    {0,240551,858367},
-    {1,784489,800034},
-    {2,120347,636418},
-    {3,641991,659005},
-    {4,53899.9,497101},
-    {5,431034,541011},
-    {6,-20323.2,389328},
-    {7,386094,466448},
+    {0,1,-240551,858367},
+    {1,1,-784489,800034},
+    {2,1,-120347,636418},
+    {3,1,-641991,659005},
+    {4,1,-53899.9,497101},
+    {5,1,-431034,541011},
+    {6,1,20323.2,389328},
+    {7,1,-386094,466448},
   },
 },
 // move 55
@@ -3637,63 +3637,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-595956,779221},
+    {0,1,595956,779221},
   },
   // deep = 2
   {
-    {0,-27687.6,803935},
-    {1,568268,699743},
+    {0,1,27687.6,803935},
+    {1,1,-568268,699743},
   },
   // deep = 3
   {
-    {0,-563050,922160},
-    {1,32905.4,645089},
-    {2,-535363,633587},
+    {0,1,563050,922160},
+    {1,1,-32905.4,645089},
+    {2,1,535363,633587},
   },
   // deep = 4
   {
-    {0,-139774,888427},
-    {1,456182,765809},
-    {2,-112086,596329},
-    {3,423277,582952},
+    {0,1,139774,888427},
+    {1,1,-456182,765809},
+    {2,1,112086,596329},
+    {3,1,-423277,582952},
   },
   // deep = 5
   {
-    {0,-558365,900970},
-    {1,37590.8,688059},
-    {2,-530677,671919},
-    {3,4685.39,537226},
-    {4,-418591,536189},
+    {0,1,558365,900970},
+    {1,1,-37590.8,688059},
+    {2,1,530677,671919},
+    {3,1,-4685.39,537226},
+    {4,1,418591,536189},
   },
   // deep = 6
   {
-    {0,-174111,888739},
-    {1,421845,778596},
-    {2,-146423,643162},
-    {3,388939,612718},
-    {4,-34337.3,459592},
-    {5,384254,494215},
+    {0,1,174111,888739},
+    {1,1,-421845,778596},
+    {2,1,146423,643162},
+    {3,1,-388939,612718},
+    {4,1,34337.3,459592},
+    {5,1,-384254,494215},
   },
   // deep = 7
   {
-    {0,-518991,945363},
-    {1,76965.2,787198},
-    {2,-491303,767340},
-    {3,44059.8,628717},
-    {4,-379217,611280},
-    {5,39374.4,467527},
-    {6,-344880,532891},
+    {0,1,518991,945363},
+    {1,1,-76965.2,787198},
+    {2,1,491303,767340},
+    {3,1,-44059.8,628717},
+    {4,1,379217,611280},
+    {5,1,-39374.4,467527},
+    {6,1,344880,532891},
   },
   // deep = 8
   {
-    {0,-510184,917524},
-    {1,85771.5,795934},
-    {2,-482497,702986},
-    {3,52866.1,664633},
-    {4,-370411,565255},
-    {5,48180.7,548957},
-    {6,-336073,442880},
-    {7,8806.28,542591},
+    {0,1,510184,917524},
+    {1,1,-85771.5,795934},
+    {2,1,482497,702986},
+    {3,1,-52866.1,664633},
+    {4,1,370411,565255},
+    {5,1,-48180.7,548957},
+    {6,1,336073,442880},
+    {7,1,-8806.28,542591},
   },
 },
 // move 56
@@ -3703,63 +3703,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-491150,787406},
+    {0,1,491150,787406},
   },
   // deep = 2
   {
-    {0,188509,836092},
-    {1,679659,770436},
+    {0,1,-188509,836092},
+    {1,1,-679659,770436},
   },
   // deep = 3
   {
-    {0,-211549,921525},
-    {1,279601,752626},
-    {2,-400059,691427},
+    {0,1,211549,921525},
+    {1,1,-279601,752626},
+    {2,1,400059,691427},
   },
   // deep = 4
   {
-    {0,234788,905394},
-    {1,725938,827645},
-    {2,46278.8,649392},
-    {3,446337,590785},
+    {0,1,-234788,905394},
+    {1,1,-725938,827645},
+    {2,1,-46278.8,649392},
+    {3,1,-446337,590785},
   },
   // deep = 5
   {
-    {0,-129936,958499},
-    {1,361214,830926},
-    {2,-318446,786997},
-    {3,81613.1,554595},
-    {4,-364724,572015},
+    {0,1,129936,958499},
+    {1,1,-361214,830926},
+    {2,1,318446,786997},
+    {3,1,-81613.1,554595},
+    {4,1,364724,572015},
   },
   // deep = 6
   {
-    {0,245722,978243},
-    {1,736872,910354},
-    {2,57212.4,764989},
-    {3,457271,684904},
-    {4,10933.6,536167},
-    {5,375658,572401},
+    {0,1,-245722,978243},
+    {1,1,-736872,910354},
+    {2,1,-57212.4,764989},
+    {3,1,-457271,684904},
+    {4,1,-10933.6,536167},
+    {5,1,-375658,572401},
   },
   // deep = 7
   {
-    {0,209143,981548},
-    {1,700293,885257},
-    {2,20633.7,818344},
-    {3,420692,671069},
-    {4,-25645.1,630525},
-    {5,339079,513626},
-    {6,-36578.6,604160},
+    {0,1,-209143,981548},
+    {1,1,-700293,885257},
+    {2,1,-20633.7,818344},
+    {3,1,-420692,671069},
+    {4,1,25645.1,630525},
+    {5,1,-339079,513626},
+    {6,1,36578.6,604160},
   },
   // deep = 8
   {
-    {0,83490.4,1.06089e+06},
-    {1,574640,1.01311e+06},
-    {2,-105019,899155},
-    {3,295040,833314},
-    {4,-151298,736483},
-    {5,213427,785650},
-    {6,-162231,672535},
-    {7,-125653,785210},
+    {0,1,-83490.4,1.06089e+06},
+    {1,1,-574640,1.01311e+06},
+    {2,1,105019,899155},
+    {3,1,-295040,833314},
+    {4,1,151298,736483},
+    {5,1,-213427,785650},
+    {6,1,162231,672535},
+    {7,1,125653,785210},
   },
 },
 // move 57
@@ -3769,63 +3769,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-664417,911304},
+    {0,1,664417,911304},
   },
   // deep = 2
   {
-    {0,-159027,972401},
-    {1,505391,836395},
+    {0,1,159027,972401},
+    {1,1,-505391,836395},
   },
   // deep = 3
   {
-    {0,-584773,1.01374e+06},
-    {1,79644.8,845929},
-    {2,-425746,727008},
+    {0,1,584773,1.01374e+06},
+    {1,1,-79644.8,845929},
+    {2,1,425746,727008},
   },
   // deep = 4
   {
-    {0,-147940,1.04403e+06},
-    {1,516478,985868},
-    {2,11086.6,704314},
-    {3,436833,695270},
+    {0,1,147940,1.04403e+06},
+    {1,1,-516478,985868},
+    {2,1,-11086.6,704314},
+    {3,1,-436833,695270},
   },
   // deep = 5
   {
-    {0,-511151,1.0747e+06},
-    {1,153266,917614},
-    {2,-352125,827644},
-    {3,73621.6,646311},
-    {4,-363211,670262},
+    {0,1,511151,1.0747e+06},
+    {1,1,-153266,917614},
+    {2,1,352125,827644},
+    {3,1,-73621.6,646311},
+    {4,1,363211,670262},
   },
   // deep = 6
   {
-    {0,-521311,1.06391e+06},
-    {1,143106,971193},
-    {2,-362285,800301},
-    {3,63461.4,717480},
-    {4,-373371,616092},
-    {5,-10160.2,645305},
+    {0,1,521311,1.06391e+06},
+    {1,1,-143106,971193},
+    {2,1,362285,800301},
+    {3,1,-63461.4,717480},
+    {4,1,373371,616092},
+    {5,1,10160.2,645305},
   },
   // deep = 7
   {
-    {0,-109806,1.14533e+06},
-    {1,554611,1.06895e+06},
-    {2,49220.1,944946},
-    {3,474966,861167},
-    {4,38133.5,887632},
-    {5,401345,761102},
-    {6,411505,849257},
+    {0,1,109806,1.14533e+06},
+    {1,1,-554611,1.06895e+06},
+    {2,1,-49220.1,944946},
+    {3,1,-474966,861167},
+    {4,1,-38133.5,887632},
+    {5,1,-401345,761102},
+    {6,1,-411505,849257},
   },
   // deep = 8
   {
-    {0,-109806,1.14533e+06},
-    {1,554611,1.06895e+06},
-    {2,49220.1,944946},
-    {3,474966,861167},
-    {4,38133.5,887632},
-    {5,401345,761102},
-    {6,411505,849257},
-    {7,0,0},
+    {0,1,109806,1.14533e+06},
+    {1,1,-554611,1.06895e+06},
+    {2,1,-49220.1,944946},
+    {3,1,-474966,861167},
+    {4,1,-38133.5,887632},
+    {5,1,-401345,761102},
+    {6,1,-411505,849257},
+    {7,1,0,0},
   },
 },
 // move 58
@@ -3835,63 +3835,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-464274,974220},
+    {0,1,464274,974220},
   },
   // deep = 2
   {
-    {0,7222.19,989519},
-    {1,471496,817436},
+    {0,1,-7222.19,989519},
+    {1,1,-471496,817436},
   },
   // deep = 3
   {
-    {0,-342819,1.11334e+06},
-    {1,121454,863355},
-    {2,-350042,801789},
+    {0,1,342819,1.11334e+06},
+    {1,1,-121454,863355},
+    {2,1,350042,801789},
   },
   // deep = 4
   {
-    {0,54747.4,1.12806e+06},
-    {1,519021,984344},
-    {2,47525.2,785690},
-    {3,397567,769398},
+    {0,1,-54747.4,1.12806e+06},
+    {1,1,-519021,984344},
+    {2,1,-47525.2,785690},
+    {3,1,-397567,769398},
   },
   // deep = 5
   {
-    {0,66601.1,1.1412e+06},
-    {1,530875,997792},
-    {2,59378.9,924197},
-    {3,409420,761399},
-    {4,11853.6,757109},
+    {0,1,-66601.1,1.1412e+06},
+    {1,1,-530875,997792},
+    {2,1,-59378.9,924197},
+    {3,1,-409420,761399},
+    {4,1,-11853.6,757109},
   },
   // deep = 6
   {
-    {0,-62777.2,1.18427e+06},
-    {1,401496,1.09166e+06},
-    {2,-69999.4,1.00577e+06},
-    {3,280042,951863},
-    {4,-117525,850542},
-    {5,-129378,912653},
+    {0,1,62777.2,1.18427e+06},
+    {1,1,-401496,1.09166e+06},
+    {2,1,69999.4,1.00577e+06},
+    {3,1,-280042,951863},
+    {4,1,117525,850542},
+    {5,1,129378,912653},
   },
   // deep = 7
   {
-    {0,-62777.2,1.18427e+06},
-    {1,401496,1.09166e+06},
-    {2,-69999.4,1.00577e+06},
-    {3,280042,951863},
-    {4,-117525,850542},
-    {5,-129378,912653},
-    {6,0,0},
+    {0,1,62777.2,1.18427e+06},
+    {1,1,-401496,1.09166e+06},
+    {2,1,69999.4,1.00577e+06},
+    {3,1,-280042,951863},
+    {4,1,117525,850542},
+    {5,1,129378,912653},
+    {6,1,0,0},
   },
   // deep = 8
   {
-    {0,-62777.2,1.18427e+06},
-    {1,401496,1.09166e+06},
-    {2,-69999.4,1.00577e+06},
-    {3,280042,951863},
-    {4,-117525,850542},
-    {5,-129378,912653},
-    {6,0,0},
-    {7,0,0},
+    {0,1,62777.2,1.18427e+06},
+    {1,1,-401496,1.09166e+06},
+    {2,1,69999.4,1.00577e+06},
+    {3,1,-280042,951863},
+    {4,1,117525,850542},
+    {5,1,129378,912653},
+    {6,1,0,0},
+    {7,1,0,0},
   },
 },
 // move 59
@@ -3901,63 +3901,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-456985,940666},
+    {0,1,456985,940666},
   },
   // deep = 2
   {
-    {0,-61453.9,1.01372e+06},
-    {1,395531,969681},
+    {0,1,61453.9,1.01372e+06},
+    {1,1,-395531,969681},
   },
   // deep = 3
   {
-    {0,-366038,1.13982e+06},
-    {1,90947.8,927502},
-    {2,-304584,874209},
+    {0,1,366038,1.13982e+06},
+    {1,1,-90947.8,927502},
+    {2,1,304584,874209},
   },
   // deep = 4
   {
-    {0,-386697,1.18938e+06},
-    {1,70288.3,1.10857e+06},
-    {2,-325243,866214},
-    {3,-20659.5,867132},
+    {0,1,386697,1.18938e+06},
+    {1,1,-70288.3,1.10857e+06},
+    {2,1,325243,866214},
+    {3,1,20659.5,867132},
   },
   // deep = 5
   {
-    {0,57321.7,1.25869e+06},
-    {1,514307,1.18951e+06},
-    {2,118776,1.10799e+06},
-    {3,423359,1.00369e+06},
-    {4,444019,1.06595e+06},
+    {0,1,-57321.7,1.25869e+06},
+    {1,1,-514307,1.18951e+06},
+    {2,1,-118776,1.10799e+06},
+    {3,1,-423359,1.00369e+06},
+    {4,1,-444019,1.06595e+06},
   },
   // deep = 6
   {
-    {0,57321.7,1.25869e+06},
-    {1,514307,1.18951e+06},
-    {2,118776,1.10799e+06},
-    {3,423359,1.00369e+06},
-    {4,444019,1.06595e+06},
-    {5,0,0},
+    {0,1,-57321.7,1.25869e+06},
+    {1,1,-514307,1.18951e+06},
+    {2,1,-118776,1.10799e+06},
+    {3,1,-423359,1.00369e+06},
+    {4,1,-444019,1.06595e+06},
+    {5,1,0,0},
   },
   // deep = 7
   {
-    {0,57321.7,1.25869e+06},
-    {1,514307,1.18951e+06},
-    {2,118776,1.10799e+06},
-    {3,423359,1.00369e+06},
-    {4,444019,1.06595e+06},
-    {5,0,0},
-    {6,0,0},
+    {0,1,-57321.7,1.25869e+06},
+    {1,1,-514307,1.18951e+06},
+    {2,1,-118776,1.10799e+06},
+    {3,1,-423359,1.00369e+06},
+    {4,1,-444019,1.06595e+06},
+    {5,1,0,0},
+    {6,1,0,0},
   },
   // deep = 8
   {
-    {0,57321.7,1.25869e+06},
-    {1,514307,1.18951e+06},
-    {2,118776,1.10799e+06},
-    {3,423359,1.00369e+06},
-    {4,444019,1.06595e+06},
-    {5,0,0},
-    {6,0,0},
-    {7,0,0},
+    {0,1,-57321.7,1.25869e+06},
+    {1,1,-514307,1.18951e+06},
+    {2,1,-118776,1.10799e+06},
+    {3,1,-423359,1.00369e+06},
+    {4,1,-444019,1.06595e+06},
+    {5,1,0,0},
+    {6,1,0,0},
+    {7,1,0,0},
   },
 },
 // move 60
@@ -3967,63 +3967,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-337037,1.05179e+06},
+    {0,1,337037,1.05179e+06},
   },
   // deep = 2
   {
-    {0,39179.4,1.09847e+06},
-    {1,376216,975523},
+    {0,1,-39179.4,1.09847e+06},
+    {1,1,-376216,975523},
   },
   // deep = 3
   {
-    {0,92006.5,1.23975e+06},
-    {1,429043,959513},
-    {2,52827.1,925461},
+    {0,1,-92006.5,1.23975e+06},
+    {1,1,-429043,959513},
+    {2,1,-52827.1,925461},
   },
   // deep = 4
   {
-    {0,-53290.1,1.24398e+06},
-    {1,283747,1.21587e+06},
-    {2,-92469.5,1.05414e+06},
-    {3,-145297,1.11778e+06},
+    {0,1,53290.1,1.24398e+06},
+    {1,1,-283747,1.21587e+06},
+    {2,1,92469.5,1.05414e+06},
+    {3,1,145297,1.11778e+06},
   },
   // deep = 5
   {
-    {0,-53290.1,1.24398e+06},
-    {1,283747,1.21587e+06},
-    {2,-92469.5,1.05414e+06},
-    {3,-145297,1.11778e+06},
-    {4,0,0},
+    {0,1,53290.1,1.24398e+06},
+    {1,1,-283747,1.21587e+06},
+    {2,1,92469.5,1.05414e+06},
+    {3,1,145297,1.11778e+06},
+    {4,1,0,0},
   },
   // deep = 6
   {
-    {0,-53290.1,1.24398e+06},
-    {1,283747,1.21587e+06},
-    {2,-92469.5,1.05414e+06},
-    {3,-145297,1.11778e+06},
-    {4,0,0},
-    {5,0,0},
+    {0,1,53290.1,1.24398e+06},
+    {1,1,-283747,1.21587e+06},
+    {2,1,92469.5,1.05414e+06},
+    {3,1,145297,1.11778e+06},
+    {4,1,0,0},
+    {5,1,0,0},
   },
   // deep = 7
   {
-    {0,-53290.1,1.24398e+06},
-    {1,283747,1.21587e+06},
-    {2,-92469.5,1.05414e+06},
-    {3,-145297,1.11778e+06},
-    {4,0,0},
-    {5,0,0},
-    {6,0,0},
+    {0,1,53290.1,1.24398e+06},
+    {1,1,-283747,1.21587e+06},
+    {2,1,92469.5,1.05414e+06},
+    {3,1,145297,1.11778e+06},
+    {4,1,0,0},
+    {5,1,0,0},
+    {6,1,0,0},
   },
   // deep = 8
   {
-    {0,-53290.1,1.24398e+06},
-    {1,283747,1.21587e+06},
-    {2,-92469.5,1.05414e+06},
-    {3,-145297,1.11778e+06},
-    {4,0,0},
-    {5,0,0},
-    {6,0,0},
-    {7,0,0},
+    {0,1,53290.1,1.24398e+06},
+    {1,1,-283747,1.21587e+06},
+    {2,1,92469.5,1.05414e+06},
+    {3,1,145297,1.11778e+06},
+    {4,1,0,0},
+    {5,1,0,0},
+    {6,1,0,0},
+    {7,1,0,0},
   },
 },
 // move 61
@@ -4033,63 +4033,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,-317623,1.05205e+06},
+    {0,1,317623,1.05205e+06},
   },
   // deep = 2
   {
-    {0,-377901,1.1483e+06},
-    {1,-60278.2,1.10087e+06},
+    {0,1,377901,1.1483e+06},
+    {1,1,60278.2,1.10087e+06},
   },
   // deep = 3
   {
-    {0,69504.4,1.29969e+06},
-    {1,387127,1.25341e+06},
-    {2,447406,1.24962e+06},
+    {0,1,-69504.4,1.29969e+06},
+    {1,1,-387127,1.25341e+06},
+    {2,1,-447406,1.24962e+06},
   },
   // deep = 4
   {
-    {0,69504.4,1.29969e+06},
-    {1,387127,1.25341e+06},
-    {2,447406,1.24962e+06},
-    {3,0,0},
+    {0,1,-69504.4,1.29969e+06},
+    {1,1,-387127,1.25341e+06},
+    {2,1,-447406,1.24962e+06},
+    {3,1,0,0},
   },
   // deep = 5
   {
-    {0,69504.4,1.29969e+06},
-    {1,387127,1.25341e+06},
-    {2,447406,1.24962e+06},
-    {3,0,0},
-    {4,0,0},
+    {0,1,-69504.4,1.29969e+06},
+    {1,1,-387127,1.25341e+06},
+    {2,1,-447406,1.24962e+06},
+    {3,1,0,0},
+    {4,1,0,0},
   },
   // deep = 6
   {
-    {0,69504.4,1.29969e+06},
-    {1,387127,1.25341e+06},
-    {2,447406,1.24962e+06},
-    {3,0,0},
-    {4,0,0},
-    {5,0,0},
+    {0,1,-69504.4,1.29969e+06},
+    {1,1,-387127,1.25341e+06},
+    {2,1,-447406,1.24962e+06},
+    {3,1,0,0},
+    {4,1,0,0},
+    {5,1,0,0},
   },
   // deep = 7
   {
-    {0,69504.4,1.29969e+06},
-    {1,387127,1.25341e+06},
-    {2,447406,1.24962e+06},
-    {3,0,0},
-    {4,0,0},
-    {5,0,0},
-    {6,0,0},
+    {0,1,-69504.4,1.29969e+06},
+    {1,1,-387127,1.25341e+06},
+    {2,1,-447406,1.24962e+06},
+    {3,1,0,0},
+    {4,1,0,0},
+    {5,1,0,0},
+    {6,1,0,0},
   },
   // deep = 8
   {
-    {0,69504.4,1.29969e+06},
-    {1,387127,1.25341e+06},
-    {2,447406,1.24962e+06},
-    {3,0,0},
-    {4,0,0},
-    {5,0,0},
-    {6,0,0},
-    {7,0,0},
+    {0,1,-69504.4,1.29969e+06},
+    {1,1,-387127,1.25341e+06},
+    {2,1,-447406,1.24962e+06},
+    {3,1,0,0},
+    {4,1,0,0},
+    {5,1,0,0},
+    {6,1,0,0},
+    {7,1,0,0},
   },
 },
 // move 62
@@ -4099,63 +4099,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,154772,1.14971e+06},
+    {0,1,-154772,1.14971e+06},
   },
   // deep = 2
   {
-    {0,-1362.61,1.33217e+06},
-    {1,-156135,1.33174e+06},
+    {0,1,1362.61,1.33217e+06},
+    {1,1,156135,1.33174e+06},
   },
   // deep = 3
   {
-    {0,-1362.61,1.33217e+06},
-    {1,-156135,1.33174e+06},
-    {2,0,0},
+    {0,1,1362.61,1.33217e+06},
+    {1,1,156135,1.33174e+06},
+    {2,1,0,0},
   },
   // deep = 4
   {
-    {0,-1362.61,1.33217e+06},
-    {1,-156135,1.33174e+06},
-    {2,0,0},
-    {3,0,0},
+    {0,1,1362.61,1.33217e+06},
+    {1,1,156135,1.33174e+06},
+    {2,1,0,0},
+    {3,1,0,0},
   },
   // deep = 5
   {
-    {0,-1362.61,1.33217e+06},
-    {1,-156135,1.33174e+06},
-    {2,0,0},
-    {3,0,0},
-    {4,0,0},
+    {0,1,1362.61,1.33217e+06},
+    {1,1,156135,1.33174e+06},
+    {2,1,0,0},
+    {3,1,0,0},
+    {4,1,0,0},
   },
   // deep = 6
   {
-    {0,-1362.61,1.33217e+06},
-    {1,-156135,1.33174e+06},
-    {2,0,0},
-    {3,0,0},
-    {4,0,0},
-    {5,0,0},
+    {0,1,1362.61,1.33217e+06},
+    {1,1,156135,1.33174e+06},
+    {2,1,0,0},
+    {3,1,0,0},
+    {4,1,0,0},
+    {5,1,0,0},
   },
   // deep = 7
   {
-    {0,-1362.61,1.33217e+06},
-    {1,-156135,1.33174e+06},
-    {2,0,0},
-    {3,0,0},
-    {4,0,0},
-    {5,0,0},
-    {6,0,0},
+    {0,1,1362.61,1.33217e+06},
+    {1,1,156135,1.33174e+06},
+    {2,1,0,0},
+    {3,1,0,0},
+    {4,1,0,0},
+    {5,1,0,0},
+    {6,1,0,0},
   },
   // deep = 8
   {
-    {0,-1362.61,1.33217e+06},
-    {1,-156135,1.33174e+06},
-    {2,0,0},
-    {3,0,0},
-    {4,0,0},
-    {5,0,0},
-    {6,0,0},
-    {7,0,0},
+    {0,1,1362.61,1.33217e+06},
+    {1,1,156135,1.33174e+06},
+    {2,1,0,0},
+    {3,1,0,0},
+    {4,1,0,0},
+    {5,1,0,0},
+    {6,1,0,0},
+    {7,1,0,0},
   },
 },
 // move 63
@@ -4165,63 +4165,63 @@ extern const ProbCutInfo prob_cut_info_long[num_squares][max_probcut_depth+1][ma
   },
   // deep = 1
   {
-    {0,195084,1.35154e+06},
+    {0,1,-195084,1.35154e+06},
   },
   // deep = 2
   {
-    {0,195084,1.35154e+06},
-    {1,0,0},
+    {0,1,-195084,1.35154e+06},
+    {1,1,0,0},
   },
   // deep = 3
   {
-    {0,195084,1.35154e+06},
-    {1,0,0},
-    {2,0,0},
+    {0,1,-195084,1.35154e+06},
+    {1,1,0,0},
+    {2,1,0,0},
   },
   // deep = 4
   {
-    {0,195084,1.35154e+06},
-    {1,0,0},
-    {2,0,0},
-    {3,0,0},
+    {0,1,-195084,1.35154e+06},
+    {1,1,0,0},
+    {2,1,0,0},
+    {3,1,0,0},
   },
   // deep = 5
   {
-    {0,195084,1.35154e+06},
-    {1,0,0},
-    {2,0,0},
-    {3,0,0},
-    {4,0,0},
+    {0,1,-195084,1.35154e+06},
+    {1,1,0,0},
+    {2,1,0,0},
+    {3,1,0,0},
+    {4,1,0,0},
   },
   // deep = 6
   {
-    {0,195084,1.35154e+06},
-    {1,0,0},
-    {2,0,0},
-    {3,0,0},
-    {4,0,0},
-    {5,0,0},
+    {0,1,-195084,1.35154e+06},
+    {1,1,0,0},
+    {2,1,0,0},
+    {3,1,0,0},
+    {4,1,0,0},
+    {5,1,0,0},
   },
   // deep = 7
   {
-    {0,195084,1.35154e+06},
-    {1,0,0},
-    {2,0,0},
-    {3,0,0},
-    {4,0,0},
-    {5,0,0},
-    {6,0,0},
+    {0,1,-195084,1.35154e+06},
+    {1,1,0,0},
+    {2,1,0,0},
+    {3,1,0,0},
+    {4,1,0,0},
+    {5,1,0,0},
+    {6,1,0,0},
   },
   // deep = 8
   {
-    {0,195084,1.35154e+06},
-    {1,0,0},
-    {2,0,0},
-    {3,0,0},
-    {4,0,0},
-    {5,0,0},
-    {6,0,0},
-    {7,0,0},
+    {0,1,-195084,1.35154e+06},
+    {1,1,0,0},
+    {2,1,0,0},
+    {3,1,0,0},
+    {4,1,0,0},
+    {5,1,0,0},
+    {6,1,0,0},
+    {7,1,0,0},
   },
 },
 };
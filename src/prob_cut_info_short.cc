@@ -2,770 +2,770 @@
 extern const ProbCutInfo prob_cut_info_short[num_squares][max_probcut_depth+1] = {
 // move 0
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,1484.37,124976},
-  {1,-4302.94,74351.3},
-  {2,2469.53,57671.6},
-  {3,489.602,59355},
-  {2,2619.85,82771.7},
-  {3,1187.45,74958.7},
-  {4,10124.4,66844.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-1484.37,124976},
+  {1,1,4302.94,74351.3},
+  {2,1,-2469.53,57671.6},
+  {3,1,-489.602,59355},
+  {2,1,-2619.85,82771.7},
+  {3,1,-1187.45,74958.7},
+  {4,1,-10124.4,66844.7},
 },
 // move 1
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,1484.37,124976},
-  {1,-4302.94,74351.3},
-  {2,2469.53,57671.6},
-  {3,489.602,59355},
-  {2,2619.85,82771.7},
-  {3,1187.45,74958.7},
-  {4,10124.4,66844.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-1484.37,124976},
+  {1,1,4302.94,74351.3},
+  {2,1,-2469.53,57671.6},
+  {3,1,-489.602,59355},
+  {2,1,-2619.85,82771.7},
+  {3,1,-1187.45,74958.7},
+  {4,1,-10124.4,66844.7},
 },
 // move 2
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,1484.37,124976},
-  {1,-4302.94,74351.3},
-  {2,2469.53,57671.6},
-  {3,489.602,59355},
-  {2,2619.85,82771.7},
-  {3,1187.45,74958.7},
-  {4,10124.4,66844.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-1484.37,124976},
+  {1,1,4302.94,74351.3},
+  {2,1,-2469.53,57671.6},
+  {3,1,-489.602,59355},
+  {2,1,-2619.85,82771.7},
+  {3,1,-1187.45,74958.7},
+  {4,1,-10124.4,66844.7},
 },
 // move 3
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,1484.37,124976},
-  {1,-4302.94,74351.3},
-  {2,2469.53,57671.6},
-  {3,489.602,59355},
-  {2,2619.85,82771.7},
-  {3,1187.45,74958.7},
-  {4,10124.4,66844.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-1484.37,124976},
+  {1,1,4302.94,74351.3},
+  {2,1,-2469.53,57671.6},
+  {3,1,-489.602,59355},
+  {2,1,-2619.85,82771.7},
+  {3,1,-1187.45,74958.7},
+  {4,1,-10124.4,66844.7},
 },
 // move 4
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,1484.37,124976},
-  {1,-4302.94,74351.3},
-  {2,2469.53,57671.6},
-  {3,489.602,59355},
-  {2,2619.85,82771.7},
-  {3,1187.45,74958.7},
-  {4,10124.4,66844.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-1484.37,124976},
+  {1,1,4302.94,74351.3},
+  {2,1,-2469.53,57671.6},
+  {3,1,-489.602,59355},
+  {2,1,-2619.85,82771.7},
+  {3,1,-1187.45,74958.7},
+  {4,1,-10124.4,66844.7},
 },
 // move 5
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,1484.37,124976},
-  {1,-4302.94,74351.3},
-  {2,2469.53,57671.6},
-  {3,489.602,59355},
-  {2,2619.85,82771.7},
-  {3,1187.45,74958.7},
-  {4,10124.4,66844.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-1484.37,124976},
+  {1,1,4302.94,74351.3},
+  {2,1,-2469.53,57671.6},
+  {3,1,-489.602,59355},
+  {2,1,-2619.85,82771.7},
+  {3,1,-1187.45,74958.7},
+  {4,1,-10124.4,66844.7},
 },
 // move 6
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,1484.37,124976},
-  {1,-4302.94,74351.3},
-  {2,2469.53,57671.6},
-  {3,489.602,59355},
-  {2,2619.85,82771.7},
-  {3,1187.45,74958.7},
-  {4,10124.4,66844.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-1484.37,124976},
+  {1,1,4302.94,74351.3},
+  {2,1,-2469.53,57671.6},
+  {3,1,-489.602,59355},
+  {2,1,-2619.85,82771.7},
+  {3,1,-1187.45,74958.7},
+  {4,1,-10124.4,66844.7},
 },
 // move 7
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,1484.37,124976},
-  {1,-4302.94,74351.3},
-  {2,2469.53,57671.6},
-  {3,489.602,59355},
-  {2,2619.85,82771.7},
-  {3,1187.45,74958.7},
-  {4,10124.4,66844.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-1484.37,124976},
+  {1,1,4302.94,74351.3},
+  {2,1,-2469.53,57671.6},
+  {3,1,-489.602,59355},
+  {2,1,-2619.85,82771.7},
+  {3,1,-1187.45,74958.7},
+  {4,1,-10124.4,66844.7},
 },
 // move 8
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,1484.37,124976},
-  {1,-4302.94,74351.3},
-  {2,2469.53,57671.6},
-  {3,489.602,59355},
-  {2,2619.85,82771.7},
-  {3,1187.45,74958.7},
-  {4,10124.4,66844.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-1484.37,124976},
+  {1,1,4302.94,74351.3},
+  {2,1,-2469.53,57671.6},
+  {3,1,-489.602,59355},
+  {2,1,-2619.85,82771.7},
+  {3,1,-1187.45,74958.7},
+  {4,1,-10124.4,66844.7},
 },
 // move 9
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,6258.41,81509.5},
-  {1,-580.623,63467},
-  {2,2075.92,58234.1},
-  {3,3502.91,65386.2},
-  {2,5297.39,78681.4},
-  {3,-3572.62,77114.2},
-  {4,-4568.2,57374.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-6258.41,81509.5},
+  {1,1,580.623,63467},
+  {2,1,-2075.92,58234.1},
+  {3,1,-3502.91,65386.2},
+  {2,1,-5297.39,78681.4},
+  {3,1,3572.62,77114.2},
+  {4,1,4568.2,57374.7},
 },
 // move 10
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,1877.39,68854.8},
-  {1,1487.66,65676.3},
-  {2,2338.31,67693.1},
-  {3,3093.52,52351.1},
-  {2,12789.9,82765.8},
-  {3,12404.9,72465.1},
-  {4,20826.9,53177.9},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-1877.39,68854.8},
+  {1,1,-1487.66,65676.3},
+  {2,1,-2338.31,67693.1},
+  {3,1,-3093.52,52351.1},
+  {2,1,-12789.9,82765.8},
+  {3,1,-12404.9,72465.1},
+  {4,1,-20826.9,53177.9},
 },
 // move 11
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,9443.92,78066},
-  {1,8052.53,76553.7},
-  {2,5588.17,50272.4},
-  {3,-4165.43,52022.7},
-  {2,-1072.9,75595.5},
-  {3,-11523.3,76397.3},
-  {4,-10216.2,64966.1},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-9443.92,78066},
+  {1,1,-8052.53,76553.7},
+  {2,1,-5588.17,50272.4},
+  {3,1,4165.43,52022.7},
+  {2,1,1072.9,75595.5},
+  {3,1,11523.3,76397.3},
+  {4,1,10216.2,64966.1},
 },
 // move 12
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-2038.87,77541.1},
-  {1,906.258,69101.2},
-  {2,8198.52,49056.7},
-  {3,9032.2,57506.6},
-  {2,18841.6,73573.2},
-  {3,17235.4,69260.4},
-  {4,9859.53,56184.5},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,2038.87,77541.1},
+  {1,1,-906.258,69101.2},
+  {2,1,-8198.52,49056.7},
+  {3,1,-9032.2,57506.6},
+  {2,1,-18841.6,73573.2},
+  {3,1,-17235.4,69260.4},
+  {4,1,-9859.53,56184.5},
 },
 // move 13
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,13284.4,70661},
-  {1,2502.87,63972.5},
-  {2,-548.186,59647.3},
-  {3,-4652.16,50563.2},
-  {2,-6206.61,78616.1},
-  {3,2018.9,75196.1},
-  {4,10296.3,64018.5},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-13284.4,70661},
+  {1,1,-2502.87,63972.5},
+  {2,1,548.186,59647.3},
+  {3,1,4652.16,50563.2},
+  {2,1,6206.61,78616.1},
+  {3,1,-2018.9,75196.1},
+  {4,1,-10296.3,64018.5},
 },
 // move 14
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,7665.94,68211.6},
-  {1,13300.1,73168},
-  {2,7012.65,57796.9},
-  {3,7880.23,47783.6},
-  {2,3671.19,77352.1},
-  {3,-2990.53,73382.5},
-  {4,-7416.82,64204.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-7665.94,68211.6},
+  {1,1,-13300.1,73168},
+  {2,1,-7012.65,57796.9},
+  {3,1,-7880.23,47783.6},
+  {2,1,-3671.19,77352.1},
+  {3,1,2990.53,73382.5},
+  {4,1,7416.82,64204.7},
 },
 // move 15
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,1583.02,78784.9},
-  {1,7848.47,88323.6},
-  {2,-454.721,57873},
-  {3,10863.8,59237.8},
-  {2,13427,81312.7},
-  {3,20582.6,76935.2},
-  {4,32015.9,67859.5},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-1583.02,78784.9},
+  {1,1,-7848.47,88323.6},
+  {2,1,454.721,57873},
+  {3,1,-10863.8,59237.8},
+  {2,1,-13427,81312.7},
+  {3,1,-20582.6,76935.2},
+  {4,1,-32015.9,67859.5},
 },
 // move 16
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,4721.86,77049.9},
-  {1,11831.5,72337.9},
-  {2,-1847.31,56928.2},
-  {3,-6313.1,68164.6},
-  {2,-5436.79,83071},
-  {3,-17105.6,86569.5},
-  {4,-15316.3,55501},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-4721.86,77049.9},
+  {1,1,-11831.5,72337.9},
+  {2,1,1847.31,56928.2},
+  {3,1,6313.1,68164.6},
+  {2,1,5436.79,83071},
+  {3,1,17105.6,86569.5},
+  {4,1,15316.3,55501},
 },
 // move 17
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,206.881,65849.2},
-  {1,17684,85744.5},
-  {2,17383,65298.1},
-  {3,14439.1,70836.6},
-  {2,35143.8,89934.4},
-  {3,35351.1,78722},
-  {4,37281.3,56444.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-206.881,65849.2},
+  {1,1,-17684,85744.5},
+  {2,1,-17383,65298.1},
+  {3,1,-14439.1,70836.6},
+  {2,1,-35143.8,89934.4},
+  {3,1,-35351.1,78722},
+  {4,1,-37281.3,56444.7},
 },
 // move 18
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-7787.61,94147.5},
-  {1,-2253.75,89797.1},
-  {2,-3510.66,70610.3},
-  {3,-7646.89,66251},
-  {2,-16336.7,96233.7},
-  {3,-19167.2,79099.4},
-  {4,-4495,63462},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,7787.61,94147.5},
+  {1,1,2253.75,89797.1},
+  {2,1,3510.66,70610.3},
+  {3,1,7646.89,66251},
+  {2,1,16336.7,96233.7},
+  {3,1,19167.2,79099.4},
+  {4,1,4495,63462},
 },
 // move 19
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,19232.9,91272.2},
-  {1,28360.4,107449},
-  {2,20317,65665.1},
-  {3,26504.2,55643.6},
-  {2,41116.9,78441.1},
-  {3,28481.1,83692.9},
-  {4,31770,62955.8},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-19232.9,91272.2},
+  {1,1,-28360.4,107449},
+  {2,1,-20317,65665.1},
+  {3,1,-26504.2,55643.6},
+  {2,1,-41116.9,78441.1},
+  {3,1,-28481.1,83692.9},
+  {4,1,-31770,62955.8},
 },
 // move 20
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-14467.9,109659},
-  {1,4886.56,99561.5},
-  {2,-11634.5,81154.8},
-  {3,-9652.8,74579.5},
-  {2,-4022.46,106489},
-  {3,-11709,85367.1},
-  {4,20330.3,64310.9},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,14467.9,109659},
+  {1,1,-4886.56,99561.5},
+  {2,1,11634.5,81154.8},
+  {3,1,9652.8,74579.5},
+  {2,1,4022.46,106489},
+  {3,1,11709,85367.1},
+  {4,1,-20330.3,64310.9},
 },
 // move 21
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,14074.8,100054},
-  {1,42450.4,115890},
-  {2,24449.5,76136.4},
-  {3,6775.16,71512.9},
-  {2,33324.7,94353.9},
-  {3,4061.24,88388.2},
-  {4,7042.37,65522.9},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-14074.8,100054},
+  {1,1,-42450.4,115890},
+  {2,1,-24449.5,76136.4},
+  {3,1,-6775.16,71512.9},
+  {2,1,-33324.7,94353.9},
+  {3,1,-4061.24,88388.2},
+  {4,1,-7042.37,65522.9},
 },
 // move 22
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-22974.6,110407},
-  {1,842.77,105406},
-  {2,7784.47,75334.5},
-  {3,7031.63,80954.6},
-  {2,22696.4,103856},
-  {3,22788.7,103986},
-  {4,37240.3,77399.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,22974.6,110407},
+  {1,1,-842.77,105406},
+  {2,1,-7784.47,75334.5},
+  {3,1,-7031.63,80954.6},
+  {2,1,-22696.4,103856},
+  {3,1,-22788.7,103986},
+  {4,1,-37240.3,77399.7},
 },
 // move 23
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,9969.82,118347},
-  {1,13885,117094},
-  {2,8938.99,95347.9},
-  {3,5168.95,85448.8},
-  {2,5709.87,122099},
-  {3,-3870.6,105185},
-  {4,14324.9,79036.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-9969.82,118347},
+  {1,1,-13885,117094},
+  {2,1,-8938.99,95347.9},
+  {3,1,-5168.95,85448.8},
+  {2,1,-5709.87,122099},
+  {3,1,3870.6,105185},
+  {4,1,-14324.9,79036.7},
 },
 // move 24
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,6851.57,103372},
-  {1,24109.2,125122},
-  {2,6320.85,83325.7},
-  {3,19865,97109.2},
-  {2,28307.6,105959},
-  {3,21610.3,119350},
-  {4,67078.8,68825.9},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-6851.57,103372},
+  {1,1,-24109.2,125122},
+  {2,1,-6320.85,83325.7},
+  {3,1,-19865,97109.2},
+  {2,1,-28307.6,105959},
+  {3,1,-21610.3,119350},
+  {4,1,-67078.8,68825.9},
 },
 // move 25
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-330.049,140248},
-  {1,4907.18,124285},
-  {2,-6079.67,100528},
-  {3,3931.99,93058.7},
-  {2,9312.7,119667},
-  {3,-28951,108150},
-  {4,29849.3,80483.3},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,330.049,140248},
+  {1,1,-4907.18,124285},
+  {2,1,6079.67,100528},
+  {3,1,-3931.99,93058.7},
+  {2,1,-9312.7,119667},
+  {3,1,28951,108150},
+  {4,1,-29849.3,80483.3},
 },
 // move 26
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,20028.5,134806},
-  {1,56887.9,161349},
-  {2,9399.03,108247},
-  {3,1399.2,85424.1},
-  {2,54896.7,121642},
-  {3,-392.32,109225},
-  {4,51607.7,75977.4},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-20028.5,134806},
+  {1,1,-56887.9,161349},
+  {2,1,-9399.03,108247},
+  {3,1,-1399.2,85424.1},
+  {2,1,-54896.7,121642},
+  {3,1,392.32,109225},
+  {4,1,-51607.7,75977.4},
 },
 // move 27
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-21930.4,143049},
-  {1,22205.4,135675},
-  {2,22749.8,91281.3},
-  {3,-14956.9,99444},
-  {2,40490.2,118149},
-  {3,-2635.61,130288},
-  {4,73750,81816.9},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,21930.4,143049},
+  {1,1,-22205.4,135675},
+  {2,1,-22749.8,91281.3},
+  {3,1,14956.9,99444},
+  {2,1,-40490.2,118149},
+  {3,1,2635.61,130288},
+  {4,1,-73750,81816.9},
 },
 // move 28
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,11086,129572},
-  {1,11003.5,132025},
-  {2,37244.4,99363.7},
-  {3,5316.08,84260.9},
-  {2,38200.4,128195},
-  {3,-34807.3,107138},
-  {4,5099.37,85996.9},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-11086,129572},
+  {1,1,-11003.5,132025},
+  {2,1,-37244.4,99363.7},
+  {3,1,-5316.08,84260.9},
+  {2,1,-38200.4,128195},
+  {3,1,34807.3,107138},
+  {4,1,-5099.37,85996.9},
 },
 // move 29
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,21086.4,124763},
-  {1,7304.04,140003},
-  {2,13290.4,97952.2},
-  {3,22167.6,96720.9},
-  {2,66482.4,115594},
-  {3,38704,122945},
-  {4,59978.8,85649.3},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-21086.4,124763},
+  {1,1,-7304.04,140003},
+  {2,1,-13290.4,97952.2},
+  {3,1,-22167.6,96720.9},
+  {2,1,-66482.4,115594},
+  {3,1,-38704,122945},
+  {4,1,-59978.8,85649.3},
 },
 // move 30
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,27678.5,159843},
-  {1,29747.2,145215},
-  {2,12254,117992},
-  {3,-24656.9,102380},
-  {2,16630.7,139413},
-  {3,-10060.1,123698},
-  {4,68282.3,91821.3},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-27678.5,159843},
+  {1,1,-29747.2,145215},
+  {2,1,-12254,117992},
+  {3,1,24656.9,102380},
+  {2,1,-16630.7,139413},
+  {3,1,10060.1,123698},
+  {4,1,-68282.3,91821.3},
 },
 // move 31
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,6641.48,153159},
-  {1,34411.5,157999},
-  {2,45544.9,110621},
-  {3,17847.8,94865.4},
-  {2,44126.5,132279},
-  {3,-34183.3,115167},
-  {4,19797,98457},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-6641.48,153159},
+  {1,1,-34411.5,157999},
+  {2,1,-45544.9,110621},
+  {3,1,-17847.8,94865.4},
+  {2,1,-44126.5,132279},
+  {3,1,34183.3,115167},
+  {4,1,-19797,98457},
 },
 // move 32
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,6236.97,165759},
-  {1,1261.27,146382},
-  {2,13529.5,109110},
-  {3,25722.9,89745.7},
-  {2,74363.4,122942},
-  {3,20728.5,122308},
-  {4,79694,93435.5},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-6236.97,165759},
+  {1,1,-1261.27,146382},
+  {2,1,-13529.5,109110},
+  {3,1,-25722.9,89745.7},
+  {2,1,-74363.4,122942},
+  {3,1,-20728.5,122308},
+  {4,1,-79694,93435.5},
 },
 // move 33
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,31486.3,157706},
-  {1,32348.3,157749},
-  {2,1654.22,97309.8},
-  {3,-34717.3,86531.3},
-  {2,15600.3,128034},
-  {3,-34118.7,124787},
-  {4,51823.3,97523.7},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-31486.3,157706},
+  {1,1,-32348.3,157749},
+  {2,1,-1654.22,97309.8},
+  {3,1,34717.3,86531.3},
+  {2,1,-15600.3,128034},
+  {3,1,34118.7,124787},
+  {4,1,-51823.3,97523.7},
 },
 // move 34
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,7779.24,167200},
-  {1,34906,143294},
-  {2,57658.8,101311},
-  {3,13025.2,95787.9},
-  {2,72648.9,132085},
-  {3,-10298.9,116437},
-  {4,66682.9,98958.3},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-7779.24,167200},
+  {1,1,-34906,143294},
+  {2,1,-57658.8,101311},
+  {3,1,-13025.2,95787.9},
+  {2,1,-72648.9,132085},
+  {3,1,10298.9,116437},
+  {4,1,-66682.9,98958.3},
 },
 // move 35
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-2092.03,158472},
-  {1,-20097.2,146918},
-  {2,16522.6,105666},
-  {3,4428.24,99173},
-  {2,47519.4,131955},
-  {3,-31993.7,125217},
-  {4,117148,88954.3},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,2092.03,158472},
+  {1,1,20097.2,146918},
+  {2,1,-16522.6,105666},
+  {3,1,-4428.24,99173},
+  {2,1,-47519.4,131955},
+  {3,1,31993.7,125217},
+  {4,1,-117148,88954.3},
 },
 // move 36
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,36512.8,187270},
-  {1,25825.2,163601},
-  {2,28333.4,105791},
-  {3,-11661.5,88819.3},
-  {2,76012.6,124554},
-  {3,-82318.2,115224},
-  {4,90259.9,89382},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-36512.8,187270},
+  {1,1,-25825.2,163601},
+  {2,1,-28333.4,105791},
+  {3,1,11661.5,88819.3},
+  {2,1,-76012.6,124554},
+  {3,1,82318.2,115224},
+  {4,1,-90259.9,89382},
 },
 // move 37
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,10276.7,200863},
-  {1,19769.6,156483},
-  {2,38463.5,127703},
-  {3,-16888.3,98376.3},
-  {2,122058,144921},
-  {3,-38790,125064},
-  {4,90291.5,91388.2},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-10276.7,200863},
+  {1,1,-19769.6,156483},
+  {2,1,-38463.5,127703},
+  {3,1,16888.3,98376.3},
+  {2,1,-122058,144921},
+  {3,1,38790,125064},
+  {4,1,-90291.5,91388.2},
 },
 // move 38
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,24203.8,187696},
-  {1,18588.9,174588},
-  {2,52549.9,115140},
-  {3,-51811.6,91549.9},
-  {2,92670.8,144836},
-  {3,-29611,121274},
-  {4,76104.1,110463},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-24203.8,187696},
+  {1,1,-18588.9,174588},
+  {2,1,-52549.9,115140},
+  {3,1,51811.6,91549.9},
+  {2,1,-92670.8,144836},
+  {3,1,29611,121274},
+  {4,1,-76104.1,110463},
 },
 // move 39
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,44279.5,186824},
-  {1,18022.7,191448},
-  {2,89569.1,115614},
-  {3,-11705.1,113759},
-  {2,91911.6,142291},
-  {3,-21707.6,136966},
-  {4,72554.1,110037},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-44279.5,186824},
+  {1,1,-18022.7,191448},
+  {2,1,-89569.1,115614},
+  {3,1,11705.1,113759},
+  {2,1,-91911.6,142291},
+  {3,1,21707.6,136966},
+  {4,1,-72554.1,110037},
 },
 // move 40
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,43621.7,224692},
-  {1,-24152.8,159004},
-  {2,55017.5,134238},
-  {3,27769.6,112047},
-  {2,85354.8,165221},
-  {3,-12350.9,145968},
-  {4,121297,113634},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-43621.7,224692},
+  {1,1,24152.8,159004},
+  {2,1,-55017.5,134238},
+  {3,1,-27769.6,112047},
+  {2,1,-85354.8,165221},
+  {3,1,12350.9,145968},
+  {4,1,-121297,113634},
 },
 // move 41
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,103811,221562},
-  {1,35879.2,199283},
-  {2,9996,133372},
-  {3,7927.03,108685},
-  {2,68123.8,165827},
-  {3,-52550.2,143783},
-  {4,84205.6,117467},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-103811,221562},
+  {1,1,-35879.2,199283},
+  {2,1,-9996,133372},
+  {3,1,-7927.03,108685},
+  {2,1,-68123.8,165827},
+  {3,1,52550.2,143783},
+  {4,1,-84205.6,117467},
 },
 // move 42
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,69103,245913},
-  {1,70594.7,197357},
-  {2,46477.3,140629},
-  {3,-12967.2,117918},
-  {2,130636,179059},
-  {3,687.491,156476},
-  {4,183991,124406},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-69103,245913},
+  {1,1,-70594.7,197357},
+  {2,1,-46477.3,140629},
+  {3,1,12967.2,117918},
+  {2,1,-130636,179059},
+  {3,1,-687.491,156476},
+  {4,1,-183991,124406},
 },
 // move 43
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,13383.6,247718},
-  {1,48273.5,211133},
-  {2,72056.3,156518},
-  {3,-44753.8,131230},
-  {2,76357.6,188390},
-  {3,-108472,162805},
-  {4,106923,135220},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-13383.6,247718},
+  {1,1,-48273.5,211133},
+  {2,1,-72056.3,156518},
+  {3,1,44753.8,131230},
+  {2,1,-76357.6,188390},
+  {3,1,108472,162805},
+  {4,1,-106923,135220},
 },
 // move 44
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,94430.2,277065},
-  {1,27044.1,232458},
-  {2,107638,167380},
-  {3,38445.1,154829},
-  {2,201250,198455},
-  {3,-16607.1,175168},
-  {4,77214.8,147666},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-94430.2,277065},
+  {1,1,-27044.1,232458},
+  {2,1,-107638,167380},
+  {3,1,-38445.1,154829},
+  {2,1,-201250,198455},
+  {3,1,16607.1,175168},
+  {4,1,-77214.8,147666},
 },
 // move 45
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,112639,296665},
-  {1,4322.15,239899},
-  {2,26184.6,193160},
-  {3,-54251.4,153659},
-  {2,110655,225120},
-  {3,12046.6,186261},
-  {4,201352,147351},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-112639,296665},
+  {1,1,-4322.15,239899},
+  {2,1,-26184.6,193160},
+  {3,1,54251.4,153659},
+  {2,1,-110655,225120},
+  {3,1,-12046.6,186261},
+  {4,1,-201352,147351},
 },
 // move 46
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,113099,318776},
-  {1,98312.7,259014},
-  {2,128622,185624},
-  {3,-41030.2,157982},
-  {2,100684,221082},
-  {3,-101966,185822},
-  {4,-12056.6,161709},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-113099,318776},
+  {1,1,-98312.7,259014},
+  {2,1,-128622,185624},
+  {3,1,41030.2,157982},
+  {2,1,-100684,221082},
+  {3,1,101966,185822},
+  {4,1,12056.6,161709},
 },
 // move 47
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,77054.2,358532},
-  {1,8527.42,288413},
-  {2,132784,220660},
-  {3,87205.1,194061},
-  {2,241083,238607},
-  {3,140525,214214},
-  {4,181198,180180},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-77054.2,358532},
+  {1,1,-8527.42,288413},
+  {2,1,-132784,220660},
+  {3,1,-87205.1,194061},
+  {2,1,-241083,238607},
+  {3,1,-140525,214214},
+  {4,1,-181198,180180},
 },
 // move 48
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,179309,392498},
-  {1,11840.3,317143},
-  {2,-8833.85,260449},
-  {3,-45431.2,199639},
-  {2,-18120.4,283041},
-  {3,-60136.1,234217},
-  {4,71621.9,196023},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-179309,392498},
+  {1,1,-11840.3,317143},
+  {2,1,8833.85,260449},
+  {3,1,45431.2,199639},
+  {2,1,18120.4,283041},
+  {3,1,60136.1,234217},
+  {4,1,-71621.9,196023},
 },
 // move 49
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,196090,410053},
-  {1,163703,332527},
-  {2,134053,256166},
-  {3,69572.4,220059},
-  {2,187608,270034},
-  {3,43967.7,270581},
-  {4,129733,235329},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-196090,410053},
+  {1,1,-163703,332527},
+  {2,1,-134053,256166},
+  {3,1,-69572.4,220059},
+  {2,1,-187608,270034},
+  {3,1,-43967.7,270581},
+  {4,1,-129733,235329},
 },
 // move 50
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,56338.2,439482},
-  {1,5850.96,387727},
-  {2,39639.1,313391},
-  {3,34640.1,262541},
-  {2,122867,360742},
-  {3,5144.16,307726},
-  {4,182354,268607},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-56338.2,439482},
+  {1,1,-5850.96,387727},
+  {2,1,-39639.1,313391},
+  {3,1,-34640.1,262541},
+  {2,1,-122867,360742},
+  {3,1,-5144.16,307726},
+  {4,1,-182354,268607},
 },
 // move 51
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,241226,559412},
-  {1,131757,450929},
-  {2,78267.3,349457},
-  {3,20268.7,301118},
-  {2,146331,399891},
-  {3,51551.7,345615},
-  {4,-100812,291689},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-241226,559412},
+  {1,1,-131757,450929},
+  {2,1,-78267.3,349457},
+  {3,1,-20268.7,301118},
+  {2,1,-146331,399891},
+  {3,1,-51551.7,345615},
+  {4,1,100812,291689},
 },
 // move 52
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,100560,590213},
-  {1,67654.2,480013},
-  {2,54237,399528},
-  {3,21962.4,342745},
-  {2,83506.3,451786},
-  {3,265620,392239},
-  {4,115461,374544},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-100560,590213},
+  {1,1,-67654.2,480013},
+  {2,1,-54237,399528},
+  {3,1,-21962.4,342745},
+  {2,1,-83506.3,451786},
+  {3,1,-265620,392239},
+  {4,1,-115461,374544},
 },
 // move 53
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,86865.6,692394},
-  {1,98796.7,542331},
-  {2,31414.4,464769},
-  {3,12066.3,391608},
-  {2,-143115,516439},
-  {3,-31347.3,466670},
-  {4,-183423,433201},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-86865.6,692394},
+  {1,1,-98796.7,542331},
+  {2,1,-31414.4,464769},
+  {3,1,-12066.3,391608},
+  {2,1,143115,516439},
+  {3,1,31347.3,466670},
+  {4,1,183423,433201},
 },
 // move 54
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,120204,749261},
-  {1,142498,627632},
-  {2,66447.5,494142},
-  {3,210956,477662},
-  {2,140671,575025},
-  {3,255897,525355},
-  {4,53899.9,497101},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-120204,749261},
+  {1,1,-142498,627632},
+  {2,1,-66447.5,494142},
+  {3,1,-210956,477662},
+  {2,1,-140671,575025},
+  {3,1,-255897,525355},
+  {4,1,-53899.9,497101},
 },
 // move 55
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-27687.6,803935},
-  {1,32905.4,645089},
-  {2,-112086,596329},
-  {3,4685.39,537226},
-  {2,-146423,643162},
-  {3,44059.8,628717},
-  {4,-370411,565255},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,27687.6,803935},
+  {1,1,-32905.4,645089},
+  {2,1,112086,596329},
+  {3,1,-4685.39,537226},
+  {2,1,146423,643162},
+  {3,1,-44059.8,628717},
+  {4,1,370411,565255},
 },
 // move 56
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,188509,836092},
-  {1,279601,752626},
-  {2,46278.8,649392},
-  {3,81613.1,554595},
-  {2,57212.4,764989},
-  {3,420692,671069},
-  {4,-151298,736483},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-188509,836092},
+  {1,1,-279601,752626},
+  {2,1,-46278.8,649392},
+  {3,1,-81613.1,554595},
+  {2,1,-57212.4,764989},
+  {3,1,-420692,671069},
+  {4,1,151298,736483},
 },
 // move 57
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-159027,972401},
-  {1,79644.8,845929},
-  {2,11086.6,704314},
-  {3,73621.6,646311},
-  {2,-362285,800301},
-  {3,474966,861167},
-  {4,38133.5,887632},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,159027,972401},
+  {1,1,-79644.8,845929},
+  {2,1,-11086.6,704314},
+  {3,1,-73621.6,646311},
+  {2,1,362285,800301},
+  {3,1,-474966,861167},
+  {4,1,-38133.5,887632},
 },
 // move 58
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,7222.19,989519},
-  {1,121454,863355},
-  {2,47525.2,785690},
-  {3,409420,761399},
-  {2,-69999.4,1.00577e+06},
-  {3,280042,951863},
-  {4,-117525,850542},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-7222.19,989519},
+  {1,1,-121454,863355},
+  {2,1,-47525.2,785690},
+  {3,1,-409420,761399},
+  {2,1,69999.4,1.00577e+06},
+  {3,1,-280042,951863},
+  {4,1,117525,850542},
 },
 // move 59
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-61453.9,1.01372e+06},
-  {1,90947.8,927502},
-  {2,-325243,866214},
-  {3,423359,1.00369e+06},
-  {2,118776,1.10799e+06},
-  {3,423359,1.00369e+06},
-  {4,444019,1.06595e+06},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,61453.9,1.01372e+06},
+  {1,1,-90947.8,927502},
+  {2,1,325243,866214},
+  {3,1,-423359,1.00369e+06},
+  {2,1,-118776,1.10799e+06},
+  {3,1,-423359,1.00369e+06},
+  {4,1,-444019,1.06595e+06},
 },
 // move 60
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,39179.4,1.09847e+06},
-  {1,429043,959513},
-  {2,-92469.5,1.05414e+06},
-  {3,-145297,1.11778e+06},
-  {2,-92469.5,1.05414e+06},
-  {3,-145297,1.11778e+06},
-  {4,0,0},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-39179.4,1.09847e+06},
+  {1,1,-429043,959513},
+  {2,1,92469.5,1.05414e+06},
+  {3,1,145297,1.11778e+06},
+  {2,1,92469.5,1.05414e+06},
+  {3,1,145297,1.11778e+06},
+  {4,1,0,0},
 },
 // move 61
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-377901,1.1483e+06},
-  {1,387127,1.25341e+06},
-  {2,447406,1.24962e+06},
-  {3,0,0},
-  {2,447406,1.24962e+06},
-  {3,0,0},
-  {4,0,0},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,377901,1.1483e+06},
+  {1,1,-387127,1.25341e+06},
+  {2,1,-447406,1.24962e+06},
+  {3,1,0,0},
+  {2,1,-447406,1.24962e+06},
+  {3,1,0,0},
+  {4,1,0,0},
 },
 // move 62
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,-1362.61,1.33217e+06},
-  {1,-156135,1.33174e+06},
-  {2,0,0},
-  {3,0,0},
-  {2,0,0},
-  {3,0,0},
-  {4,0,0},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,1362.61,1.33217e+06},
+  {1,1,156135,1.33174e+06},
+  {2,1,0,0},
+  {3,1,0,0},
+  {2,1,0,0},
+  {3,1,0,0},
+  {4,1,0,0},
 },
 // move 63
 {
-  {-1,0,0},
-  {-1,0,0},
-  {0,195084,1.35154e+06},
-  {1,0,0},
-  {2,0,0},
-  {3,0,0},
-  {2,0,0},
-  {3,0,0},
-  {4,0,0},
+  {-1,1,0,0},
+  {-1,1,0,0},
+  {0,1,-195084,1.35154e+06},
+  {1,1,0,0},
+  {2,1,0,0},
+  {3,1,0,0},
+  {2,1,0,0},
+  {3,1,0,0},
+  {4,1,0,0},
 },
 };
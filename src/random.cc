@@ -1,24 +1,50 @@
 #include "random.h"
-#include <algorithm>
-#include <functional>
+#include <atomic>
 
-class TrueRandomGenerator {
-public:
-  template<typename Iter>
-  void generate(const Iter first, const Iter second) {
-    std::generate(first, second, std::ref(get_random_device()));
+namespace {
+  std::atomic<bool> random_seed_set{false};
+  std::atomic<std::uint64_t> next_random_seed{0};
+
+  std::uint64_t splitmix64(std::uint64_t &x) {
+    x += 0x9e3779b97f4a7c15u;
+    std::uint64_t z = x;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9u;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebu;
+    return z ^ (z >> 31);
   }
-private:
-  static_assert(std::random_device::min() == 0u, "");
-  static_assert(std::random_device::max() == 0xffffffffu, "");
-};
+}
 
 std::random_device &get_random_device() {
   static std::random_device rdev;
   return rdev;
 }
 
+void set_random_seed(const std::uint64_t seed) {
+  next_random_seed = seed;
+  random_seed_set = true;
+}
+
+void clear_random_seed() {
+  random_seed_set = false;
+}
+
 RandomGenerator::RandomGenerator() {
-  TrueRandomGenerator trng;
-  urng.seed(trng);
+  if (random_seed_set) {
+    seed(next_random_seed++);
+  } else {
+    static_assert(std::random_device::min() == 0u, "");
+    static_assert(std::random_device::max() == 0xffffffffu, "");
+    std::random_device &rdev = get_random_device();
+    for (std::uint64_t &x : state) {
+      x = (std::uint64_t{rdev()} << 32) | rdev();
+    }
+    // All zeros is the one invalid state.
+    if ((state[0] | state[1] | state[2] | state[3]) == 0) seed(0);
+  }
+}
+
+void RandomGenerator::seed(std::uint64_t seed_value) {
+  for (std::uint64_t &x : state) {
+    x = splitmix64(seed_value);
+  }
 }
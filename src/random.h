@@ -2,32 +2,63 @@
 #define RANDOM_H
 
 #include "bitboard.h"
+#include <cstdint>
 #include <random>
 
 std::random_device &get_random_device();
 
+// After this, default constructed RandomGenerators get seeds derived from
+// seed rather than from the random device, so runs can be reproduced.
+void set_random_seed(std::uint64_t seed);
+
+// Back to seeding from the random device.
+void clear_random_seed();
+
+// xoshiro256**.
 class RandomGenerator {
 public:
+  using result_type = std::uint64_t;
+
   RandomGenerator();
+  explicit RandomGenerator(std::uint64_t seed_value) { seed(seed_value); }
+
+  void seed(std::uint64_t seed_value);
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() { return ~result_type{0}; }
 
+  result_type operator()() {
+    const std::uint64_t result = rotate_left(state[1] * 5, 7) * 9;
+    const std::uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotate_left(state[3], 45);
+    return result;
+  }
+
+  // 0 <= result < n. Multiply-shift: the bias is below n / 2^32.
   int get_int(const int n) {
-    //return std::uniform_int_distribution<int>{0, n-1}(urng);
-    return urng() % n;
+    return static_cast<int>(((operator()() >> 32) * std::uint64_t(n)) >> 32);
   }
 
   int get_square(const Bitboard b) {
-    // TODO: Combine count_squares with nth_square.
     const int n = count_squares(b);
     return nth_square(b, get_int(n));
   }
 
   Bitboard get_bitboard() {
-    static_assert(urng.min() == 0u && urng.max() == 0xffffffffu, "");
-    return (Bitboard{urng()} << 32) | urng();
+    return operator()();
   }
 
 private:
-  std::mt19937 urng;
+  static std::uint64_t rotate_left(const std::uint64_t x, const int k) {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  std::uint64_t state[4];
 };
 
 #endif
@@ -67,3 +67,31 @@ TEST(test_random_get_bitboard) {
     assert(cnt[sq] < mean + 4.0 * stddev);
   }
 }
+
+TEST(test_random_seed) {
+  RandomGenerator a{123};
+  RandomGenerator b;
+  b.seed(123);
+  RandomGenerator c{124};
+  bool differ = false;
+  for (int i = 0; i < 100; ++i) {
+    const Bitboard x = a.get_bitboard();
+    assert(x == b.get_bitboard());
+    differ = differ || x != c.get_bitboard();
+  }
+  assert(differ);
+
+  set_random_seed(7);
+  RandomGenerator d;
+  set_random_seed(7);
+  RandomGenerator e;
+  for (int i = 0; i < 100; ++i) {
+    assert(d.get_int(64) == e.get_int(64));
+  }
+
+  // Tests that run later get random seeds again.
+  clear_random_seed();
+  RandomGenerator f;
+  RandomGenerator g{7};
+  assert(f.get_bitboard() != g.get_bitboard());
+}
@@ -28,7 +28,7 @@ void generate_starting_positions_rec(const Position &position,
 }
 
 std::vector<Position> generate_starting_positions(const int move_number) {
-  PositionHashTable<bool> seen(1<<22);
+  PositionHashTable<bool> seen(1<<16, true);
   std::vector<Position> starting_positions;
   generate_starting_positions_rec(Position::initial(), move_number,
                                   starting_positions, seen);
@@ -0,0 +1,25 @@
+#ifndef SPIN_LOCK_H
+#define SPIN_LOCK_H
+
+#include "arch.h"
+#include <atomic>
+#include <emmintrin.h>
+
+// One byte lock for short critical sections. Works with std::lock_guard.
+class SpinLock {
+public:
+  void lock() {
+    while (locked.exchange(true, std::memory_order_acquire)) {
+      while (locked.load(std::memory_order_relaxed)) _mm_pause();
+    }
+  }
+
+  void unlock() {
+    locked.store(false, std::memory_order_release);
+  }
+
+private:
+  std::atomic<bool> locked{false};
+};
+
+#endif
@@ -0,0 +1,51 @@
+#include "sprt.h"
+#include <cassert>
+#include <cmath>
+
+Sprt::Sprt(const double elo0, const double elo1,
+           const double alpha, const double beta) :
+    score0{elo_to_score(elo0)},
+    score1{elo_to_score(elo1)},
+    lower{std::log(beta / (1.0 - alpha))},
+    upper{std::log((1.0 - beta) / alpha)} {
+  assert(elo0 < elo1);
+  assert(alpha > 0.0 && alpha < 0.5);
+  assert(beta > 0.0 && beta < 0.5);
+}
+
+double Sprt::elo_to_score(const double elo) {
+  return 1.0 / (1.0 + std::pow(10.0, -elo / 400.0));
+}
+
+void Sprt::add(const double score) {
+  assert(score >= 0.0 && score <= 1.0);
+  ++n;
+  sum += score;
+  sum_squares += score * score;
+}
+
+double Sprt::llr() const {
+  // One extra win and one extra loss, so that a run of equal results still
+  // has some variance. This pulls the mean towards 0.5, which only delays
+  // the decision.
+  const double k = n + 2;
+  const double m = (sum + 1.0) / k;
+  const double variance = (sum_squares + 1.0) / k - m * m;
+  return k * (score1 - score0) * (2.0 * m - score0 - score1) / (2.0 * variance);
+}
+
+Sprt::Result Sprt::result() const {
+  const double x = llr();
+  if (x <= lower) return Result::accept_h0;
+  if (x >= upper) return Result::accept_h1;
+  return Result::undecided;
+}
+
+const char *sprt_result_name(const Sprt::Result result) {
+  switch (result) {
+  case Sprt::Result::undecided: return "undecided";
+  case Sprt::Result::accept_h0: return "H0 accepted";
+  case Sprt::Result::accept_h1: return "H1 accepted";
+  }
+  return "";
+}
@@ -0,0 +1,46 @@
+#ifndef SPRT_H
+#define SPRT_H
+
+#include "arch.h"
+
+// Sequential probability ratio test of H0: elo = elo0 against H1: elo = elo1.
+// Each sample is a score in [0, 1], e.g. the average result of a game pair.
+// The log-likelihood ratio uses the normal approximation with the sample
+// variance, which works for any distribution of results per sample.
+class Sprt {
+public:
+  enum class Result {
+    undecided,
+    accept_h0,
+    accept_h1
+  };
+
+  // alpha: probability of accepting H1 when H0 holds.
+  // beta: probability of accepting H0 when H1 holds.
+  Sprt(double elo0, double elo1, double alpha, double beta);
+
+  void add(double score);
+
+  long num_samples() const { return n; }
+  double mean() const { return n ? sum / n : 0.0; }
+  double llr() const;
+  double lower_bound() const { return lower; }
+  double upper_bound() const { return upper; }
+  Result result() const;
+
+  static double elo_to_score(double elo);
+
+private:
+  double score0;
+  double score1;
+  double lower;
+  double upper;
+
+  long n = 0;
+  double sum = 0.0;
+  double sum_squares = 0.0;
+};
+
+const char *sprt_result_name(Sprt::Result result);
+
+#endif
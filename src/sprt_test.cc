@@ -0,0 +1,38 @@
+#include "sprt.h"
+#include "tests.h"
+#include <cmath>
+
+TEST(test_sprt_elo_to_score) {
+  assert(Sprt::elo_to_score(0.0) == 0.5);
+  assert(std::abs(Sprt::elo_to_score(400.0) - 10.0 / 11.0) < 1e-12);
+  assert(std::abs(Sprt::elo_to_score(-100.0) + Sprt::elo_to_score(100.0) - 1.0) < 1e-12);
+}
+
+TEST(test_sprt_decisions) {
+  // Alternating wins and losses: exactly elo 0.
+  Sprt even{0.0, 20.0, 0.05, 0.05};
+  while (even.result() == Sprt::Result::undecided) {
+    assert(even.num_samples() < 100000);
+    even.add(even.num_samples() % 2 ? 1.0 : 0.0);
+  }
+  assert(even.result() == Sprt::Result::accept_h0);
+  assert(even.llr() <= even.lower_bound());
+
+  // Two wins for every loss: about elo 120.
+  Sprt strong{0.0, 20.0, 0.05, 0.05};
+  while (strong.result() == Sprt::Result::undecided) {
+    assert(strong.num_samples() < 100000);
+    strong.add(strong.num_samples() % 3 ? 1.0 : 0.0);
+  }
+  assert(strong.result() == Sprt::Result::accept_h1);
+  assert(strong.llr() >= strong.upper_bound());
+
+  // Only wins.
+  Sprt wins{0.0, 20.0, 0.05, 0.05};
+  assert(wins.result() == Sprt::Result::undecided);
+  while (wins.result() == Sprt::Result::undecided) {
+    assert(wins.num_samples() < 100);
+    wins.add(1.0);
+  }
+  assert(wins.result() == Sprt::Result::accept_h1);
+}
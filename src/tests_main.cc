@@ -1,7 +1,9 @@
 #include "tests.h"
+#include "book.h"
 #include "evaluator.h"
 #include "hashing.h"
 #include "logging.h"
+#include "prepared.h"
 #include <iostream>
 #include <vector>
 
@@ -25,6 +27,8 @@ int main() {
   verbosity = 0;
   init_hashing();
   init_evaluator();
+  init_book();
+  init_prepared();
   for (const TestCase &test_case : get_all_tests()) {
     std::cerr << "Running " << test_case.name << "\n";
     test_case.f();
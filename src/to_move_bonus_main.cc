@@ -1,52 +1,135 @@
+#include "book.h"
 #include "clock.h"
 #include "evaluator.h"
+#include "game_record.h"
 #include "hashing.h"
 #include "logging.h"
 #include "mathematics.h"
+#include "parallel.h"
 #include "player_ab.h"
+#include "prepared.h"
 #include "referee_util.h"
 #include <iostream>
+#include <memory>
 
-int main() {
+namespace {
+  // Integer sums: the result doesn't depend on how the games were split
+  // between threads.
+  struct ThreadState {
+    PlayerAB player;
+    std::int64_t to_move_bonus[num_squares+1] = {};
+    std::int64_t num_samples[num_squares+1] = {};
+  };
+
+  void add_game(ThreadState &state, const GameRecord &record) {
+    std::int64_t (&to_move_bonus)[num_squares+1] = state.to_move_bonus;
+    Position pos = record.start;
+    for (int i = 0; i <= record.num_moves; ++i) {
+      to_move_bonus[pos.move_number()] -= evaluate(pos);
+      if (i < record.num_moves) pos.make_move(record.moves[i].move, pos);
+    }
+    assert(pos.finished());
+
+    const Milliscore final_score = pos.final_score() << milliscore_bits;
+
+    for(int m=record.start.move_number(); m<=num_squares; ++m) {
+      if(m%2==0) to_move_bonus[m] += final_score;
+      else to_move_bonus[m] -= final_score;
+      ++state.num_samples[m];
+    }
+  }
+}
+
+// -games <file>: use recorded games instead of playing.
+// -record <file>: record the games played.
+// -threads <n>: games in parallel.
+int main(int argc, char **argv) {
   verbosity = 0;
   init_hashing();
   init_evaluator();
+  init_book();
+  init_prepared();
 
   constexpr int initial_stones = 8;
   constexpr Duration time_per_move = std::chrono::milliseconds(100);
 
-  std::vector<std::int64_t> to_move_bonus(num_squares+1, 0);
-  const std::vector<Position> starting_positions =
-    generate_starting_positions(initial_stones);
+  GameRecordReader games_in;
+  GameRecordWriter games_out;
+  bool use_records = false;
+  int num_threads = 1;
+  for (int next = 1; next < argc; next += 2) {
+    const std::string arg{argv[next]};
+    assert(next + 1 < argc);
+    if (arg == "-games") {
+      if (!games_in.open(argv[next+1])) return 1;
+      use_records = true;
+    } else if (arg == "-record") {
+      if (!games_out.open(argv[next+1])) return 1;
+    } else if (arg == "-threads") {
+      num_threads = std::stoi(argv[next+1]);
+    } else {
+      log_always("Invalid argument: %s\n", arg.c_str());
+      return 1;
+    }
+  }
 
-  for (size_t i=0; i<starting_positions.size(); ++i) {
-    log_always("Game %zu/%zu\n", i, starting_positions.size());
-    Position pos = starting_positions[i];
-    for (;;) {
-      to_move_bonus[pos.move_number()] -= evaluate(pos);
+  assert(num_threads >= 1);
 
-      if(pos.finished()) break;
+  // Recorded games, or games to play from the starting positions.
+  std::vector<GameRecord> games;
+  if (use_records) {
+    GameRecord record;
+    while (games_in.read(record)) games.push_back(record);
+  } else {
+    for (const Position &position : generate_starting_positions(initial_stones)) {
+      games.emplace_back();
+      games.back().start = position;
+    }
+  }
 
-      PlayerAB player;
-      PlaySettings settings;
-      settings.start_time = current_time();
-      settings.time_left = time_per_move;
-      settings.use_all_resources = true;
+  std::vector<std::unique_ptr<ThreadState>> thread_states;
+  for (int i = 0; i < num_threads; ++i) {
+    thread_states.push_back(std::make_unique<ThreadState>());
+  }
 
-      const Move move = player.choose_move(pos, settings);
-      pos.make_move(move, pos);
-    }
+  parallel_for(num_threads, static_cast<long>(games.size()),
+    [&](const int thread, const long i) {
+      ThreadState &state = *thread_states[thread];
+      GameRecord &game = games[i];
+      if (!use_records) {
+        state.player.new_game();
+        Position pos = game.start;
+        while (!pos.finished()) {
+          PlaySettings settings;
+          settings.start_time = current_time();
+          settings.time_left = time_per_move;
+          settings.use_all_resources = true;
 
-    const Milliscore final_score = pos.final_score() << milliscore_bits;
+          const Move move = state.player.choose_move(pos, settings);
+          game.add_move(move, state.player, current_time() - settings.start_time);
+          pos.make_move(move, pos);
+        }
+      }
+      add_game(state, game);
+    },
+    [&](const long i) {
+      log_always("Game %ld/%zu\n", i, games.size());
+      if (!use_records && games_out.is_open()) games_out.write(games[i]);
+    });
 
-    for(int m=initial_stones; m<=num_squares; ++m) {
-      if(m%2==0) to_move_bonus[m] += final_score;
-      else to_move_bonus[m] -= final_score;
+  std::vector<std::int64_t> to_move_bonus(num_squares+1, 0);
+  std::vector<std::int64_t> num_samples(num_squares+1, 0);
+  for (const auto &state : thread_states) {
+    for (int m=0;m<=num_squares;++m) {
+      to_move_bonus[m] += state->to_move_bonus[m];
+      num_samples[m] += state->num_samples[m];
     }
   }
 
-  for (auto &b : to_move_bonus) {
-    b = rounding_divide(b, starting_positions.size());
+  for (int m=0;m<=num_squares;++m) {
+    if (num_samples[m]) {
+      to_move_bonus[m] = rounding_divide(to_move_bonus[m], num_samples[m]);
+    }
   }
 
   for (int m=0;m<=num_squares;++m) {
@@ -0,0 +1,353 @@
+#include "book.h"
+#include "clock.h"
+#include "evaluator.h"
+#include "hashing.h"
+#include "logging.h"
+#include "neural_evaluator.h"
+#include "player_ab.h"
+#include "prepared.h"
+#include "random.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Sample {
+  Position position;
+  Score score;
+};
+
+// Floating point version of NeuralWeights, in score units.
+struct FloatWeights {
+  double hidden_bias[neural_hidden_size];
+  double own[num_squares][neural_hidden_size];
+  double other[num_squares][neural_hidden_size];
+  double output[2][neural_hidden_size];
+  double output_bias[num_squares+1];
+};
+
+class NeuralTrainer {
+public:
+  NeuralTrainer(int argc, char **argv);
+  void go();
+private:
+  void generate_samples(std::size_t num_samples, std::vector<Sample> &samples);
+  void initialize_weights();
+  void train_epoch(double learning_rate);
+  double forward(const Position &position,
+                 double (&hidden)[2][neural_hidden_size]) const;
+  void quantize();
+  void report();
+
+  std::size_t num_train = 20000;
+  std::size_t num_test = 2000;
+  int min_empties = 10;
+  int max_empties = 14;
+  int epochs = 30;
+  double learning_rate = 0.002;
+  std::string input_file;
+  std::string output_file = "neural_weights.tmp";
+
+  RandomGenerator rng;
+  std::mt19937 urng{get_random_device()()};
+  PlayerAB solver;
+  std::vector<Sample> train_samples;
+  std::vector<Sample> test_samples;
+  FloatWeights weights{};
+};
+
+NeuralTrainer::NeuralTrainer(int argc, char **argv) {
+  int next = 1;
+  while (next < argc) {
+    const std::string arg(argv[next++]);
+    if (arg == "-train") {
+      assert(next < argc);
+      num_train = std::stoul(argv[next++]);
+    } else if (arg == "-test") {
+      assert(next < argc);
+      num_test = std::stoul(argv[next++]);
+    } else if (arg == "-empties") {
+      assert(next + 1 < argc);
+      min_empties = std::stoi(argv[next++]);
+      max_empties = std::stoi(argv[next++]);
+    } else if (arg == "-epochs") {
+      assert(next < argc);
+      epochs = std::stoi(argv[next++]);
+    } else if (arg == "-rate") {
+      assert(next < argc);
+      learning_rate = std::stod(argv[next++]);
+    } else if (arg == "-load") {
+      assert(next < argc);
+      input_file = argv[next++];
+    } else if (arg == "-output") {
+      assert(next < argc);
+      output_file = argv[next++];
+    } else {
+      log_always("Invalid argument: %s\n", arg.c_str());
+      std::exit(1);
+    }
+  }
+  assert(min_empties >= 1 && min_empties <= max_empties && max_empties <= 20);
+  assert(num_test > 0);
+}
+
+void NeuralTrainer::go() {
+  const Timestamp t0 = current_time();
+  generate_samples(num_train, train_samples);
+  generate_samples(num_test, test_samples);
+  const Timestamp t1 = current_time();
+  log_always("Labelled %zu positions in %.1f s\n",
+             train_samples.size() + test_samples.size(),
+             to_seconds(t1 - t0));
+
+  if (!input_file.empty()) {
+    if (!load_neural_weights(input_file)) std::exit(1);
+  } else {
+    initialize_weights();
+    for (int epoch = 0; epoch < epochs; ++epoch) {
+      const double rate = learning_rate * (epochs - epoch) / epochs;
+      train_epoch(rate);
+      quantize();
+      double total_squared = 0.0;
+      double total_squared_float = 0.0;
+      for (const Sample &sample : test_samples) {
+        const double error =
+          std::ldexp(neural_evaluate(sample.position), -milliscore_bits) -
+          sample.score;
+        total_squared += error * error;
+        double hidden[2][neural_hidden_size];
+        const double error_float = forward(sample.position, hidden) - sample.score;
+        total_squared_float += error_float * error_float;
+      }
+      log_always("epoch %d rate %.5f test rmse %.3f (unquantized %.3f)\n",
+                 epoch, rate,
+                 std::sqrt(total_squared / test_samples.size()),
+                 std::sqrt(total_squared_float / test_samples.size()));
+    }
+    if (!save_neural_weights(output_file)) {
+      log_always("Could not write %s\n", output_file.c_str());
+      std::exit(1);
+    }
+  }
+
+  report();
+}
+
+void NeuralTrainer::generate_samples(const std::size_t num_samples,
+                                     std::vector<Sample> &samples) {
+  samples.clear();
+  while (samples.size() < num_samples) {
+    const int empties = min_empties + rng.get_int(max_empties - min_empties + 1);
+    Position position = Position::initial();
+    while (num_squares - position.move_number() > empties) {
+      const Move move = rng.get_square(position.valid_moves());
+      position.make_move(move, position);
+    }
+    const Milliscore exact = solver.evaluate_depth(position, empties);
+    samples.push_back(Sample{position,
+                             static_cast<Score>(exact >> milliscore_bits)});
+  }
+}
+
+void NeuralTrainer::initialize_weights() {
+  std::normal_distribution<double> dist{0.0, 0.1};
+  for (int i = 0; i < neural_hidden_size; ++i) {
+    weights.hidden_bias[i] = 0.5;
+    weights.output[0][i] = dist(urng);
+    weights.output[1][i] = dist(urng);
+  }
+  for (int sq = 0; sq < num_squares; ++sq) {
+    for (int i = 0; i < neural_hidden_size; ++i) {
+      weights.own[sq][i] = dist(urng);
+      weights.other[sq][i] = dist(urng);
+    }
+  }
+  for (int m = 0; m <= num_squares; ++m) {
+    weights.output_bias[m] = 0.0;
+  }
+}
+
+double NeuralTrainer::forward(const Position &position,
+                              double (&hidden)[2][neural_hidden_size]) const {
+  for (int i = 0; i < neural_hidden_size; ++i) {
+    hidden[0][i] = weights.hidden_bias[i];
+    hidden[1][i] = weights.hidden_bias[i];
+  }
+  for (int sq = 0; sq < num_squares; ++sq) {
+    if (get_bit(position.player, sq)) {
+      for (int i = 0; i < neural_hidden_size; ++i) {
+        hidden[0][i] += weights.own[sq][i];
+        hidden[1][i] += weights.other[sq][i];
+      }
+    } else if (get_bit(position.opponent, sq)) {
+      for (int i = 0; i < neural_hidden_size; ++i) {
+        hidden[0][i] += weights.other[sq][i];
+        hidden[1][i] += weights.own[sq][i];
+      }
+    }
+  }
+  double result = weights.output_bias[position.move_number()];
+  for (int side = 0; side < 2; ++side) {
+    for (int i = 0; i < neural_hidden_size; ++i) {
+      result += weights.output[side][i] *
+                std::min(std::max(hidden[side][i], 0.0), 1.0);
+    }
+  }
+  return result;
+}
+
+void NeuralTrainer::train_epoch(const double rate) {
+  std::shuffle(train_samples.begin(), train_samples.end(), urng);
+  for (const Sample &sample : train_samples) {
+    double hidden[2][neural_hidden_size];
+    const double error = forward(sample.position, hidden) - sample.score;
+
+    double hidden_gradient[2][neural_hidden_size];
+    for (int side = 0; side < 2; ++side) {
+      for (int i = 0; i < neural_hidden_size; ++i) {
+        const double h = hidden[side][i];
+        const double activation = std::min(std::max(h, 0.0), 1.0);
+        hidden_gradient[side][i] =
+          (h > 0.0 && h < 1.0) ? error * weights.output[side][i] : 0.0;
+        weights.output[side][i] -= rate * error * activation;
+      }
+    }
+    weights.output_bias[sample.position.move_number()] -= rate * error;
+
+    for (int i = 0; i < neural_hidden_size; ++i) {
+      weights.hidden_bias[i] -=
+        rate * (hidden_gradient[0][i] + hidden_gradient[1][i]);
+    }
+    for (int sq = 0; sq < num_squares; ++sq) {
+      if (get_bit(sample.position.player, sq)) {
+        for (int i = 0; i < neural_hidden_size; ++i) {
+          weights.own[sq][i] -= rate * hidden_gradient[0][i];
+          weights.other[sq][i] -= rate * hidden_gradient[1][i];
+        }
+      } else if (get_bit(sample.position.opponent, sq)) {
+        for (int i = 0; i < neural_hidden_size; ++i) {
+          weights.other[sq][i] -= rate * hidden_gradient[0][i];
+          weights.own[sq][i] -= rate * hidden_gradient[1][i];
+        }
+      }
+    }
+  }
+}
+
+void NeuralTrainer::quantize() {
+  // Accumulator sums up to 65 terms; keep them well within int16.
+  constexpr double max_accumulator_weight = 400.0;
+  const auto to_int16 = [](const double x, const double limit) {
+    return static_cast<std::int16_t>(
+        std::round(std::min(std::max(x, -limit), limit)));
+  };
+  constexpr double accumulator_scale = 1 << neural_activation_bits;
+  constexpr double output_scale = 1 << neural_output_bits;
+
+  for (int i = 0; i < neural_hidden_size; ++i) {
+    neural_weights.hidden_bias[i] =
+      to_int16(weights.hidden_bias[i] * accumulator_scale, max_accumulator_weight);
+    for (int side = 0; side < 2; ++side) {
+      neural_weights.output[side][i] =
+        to_int16(weights.output[side][i] * output_scale, 32767.0);
+    }
+  }
+  for (int sq = 0; sq < num_squares; ++sq) {
+    for (int i = 0; i < neural_hidden_size; ++i) {
+      neural_weights.own[sq][i] =
+        to_int16(weights.own[sq][i] * accumulator_scale, max_accumulator_weight);
+      neural_weights.other[sq][i] =
+        to_int16(weights.other[sq][i] * accumulator_scale, max_accumulator_weight);
+    }
+  }
+  for (int m = 0; m <= num_squares; ++m) {
+    neural_weights.output_bias[m] = static_cast<Milliscore>(
+        std::round(std::ldexp(weights.output_bias[m], milliscore_bits)));
+  }
+  prepare_neural_weights();
+}
+
+void NeuralTrainer::report() {
+  // Accuracy against exact endgame scores.
+  double pattern_squared = 0.0, pattern_abs = 0.0;
+  double neural_squared = 0.0, neural_abs = 0.0;
+  for (const Sample &sample : test_samples) {
+    const double pattern_error =
+      std::ldexp(evaluate(sample.position), -milliscore_bits) - sample.score;
+    const double neural_error =
+      std::ldexp(neural_evaluate(sample.position), -milliscore_bits) - sample.score;
+    pattern_squared += pattern_error * pattern_error;
+    pattern_abs += std::fabs(pattern_error);
+    neural_squared += neural_error * neural_error;
+    neural_abs += std::fabs(neural_error);
+  }
+  const double n = test_samples.size();
+
+  // Throughput. Evaluate every child of every test position, the way
+  // alpha_beta does at depth 1.
+  std::vector<std::pair<std::size_t, Move>> children;
+  for (std::size_t i = 0; i < test_samples.size(); ++i) {
+    Bitboard moves = test_samples[i].position.valid_moves();
+    while (moves) {
+      const Move move = first_square(moves);
+      moves = remove_first_square(moves);
+      children.emplace_back(i, move);
+    }
+  }
+  constexpr int rounds = 20;
+
+  // The search refreshes only at the root, so leave this out of the timing.
+  std::vector<NeuralAccumulator> parent_accumulators(test_samples.size());
+  for (std::size_t i = 0; i < test_samples.size(); ++i) {
+    parent_accumulators[i].refresh(test_samples[i].position);
+  }
+
+  std::int64_t checksum = 0;
+  const Timestamp t0 = current_time();
+  for (int round = 0; round < rounds; ++round) {
+    for (const auto &child : children) {
+      Position next_position;
+      test_samples[child.first].position.make_move(child.second, next_position);
+      checksum += evaluate(next_position);
+    }
+  }
+  const Timestamp t1 = current_time();
+  for (int round = 0; round < rounds; ++round) {
+    for (const auto &child : children) {
+      const Position &position = test_samples[child.first].position;
+      Position next_position;
+      position.make_move(child.second, next_position);
+      NeuralAccumulator accumulator;
+      accumulator.update(parent_accumulators[child.first],
+                         position, child.second, next_position);
+      checksum += neural_evaluate(accumulator, next_position);
+    }
+  }
+  const Timestamp t2 = current_time();
+  log_verbose("checksum %lld\n", static_cast<long long>(checksum));
+
+  const double evals = static_cast<double>(children.size()) * rounds;
+  log_always("evaluator  rmse     mean_abs  Mevals/s\n");
+  log_always("pattern    %7.3f  %7.3f   %7.2f\n",
+             std::sqrt(pattern_squared / n), pattern_abs / n,
+             1e-6 * evals / to_seconds(t1 - t0));
+  log_always("neural     %7.3f  %7.3f   %7.2f\n",
+             std::sqrt(neural_squared / n), neural_abs / n,
+             1e-6 * evals / to_seconds(t2 - t1));
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  verbosity = 0;
+  init_hashing();
+  init_evaluator();
+  init_book();
+  init_prepared();
+  NeuralTrainer trainer{argc, argv};
+  trainer.go();
+}